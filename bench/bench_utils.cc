@@ -0,0 +1,360 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "bench/bench_utils.h"
+#include "framework/mesh/mesh_generator/orthogonal_mesh_generator.h"
+#include "framework/mesh/mesh_generator/from_file_mesh_generator.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/mesh/mesh.h"
+#include "framework/materials/material.h"
+#include "framework/materials/multi_group_xs/multi_group_xs.h"
+#include "framework/materials/isotropic_multigroup_source.h"
+#include "framework/math/quadratures/angular/product_quadrature.h"
+#include "framework/mesh/mesh_vector.h"
+#include <sys/resource.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+using namespace opensn;
+
+namespace bench
+{
+
+namespace
+{
+
+std::shared_ptr<BenchTransportSolver> cached_problem;
+TransportProblemSpec cached_spec;
+
+/// Returns a path in the temporary directory that is the same on all locations.
+std::string
+TemporaryFilePath(const std::string& file_name)
+{
+  return (std::filesystem::temp_directory_path() / file_name).string();
+}
+
+/**
+ * Writes an n x n x n unit-cube mesh of tetrahedra in Gmsh 2.2 format. Every hexahedron of the
+ * underlying orthogonal grid is split into the six tetrahedra sharing its main diagonal. Only
+ * location 0 writes the file. Collective.
+ */
+std::string
+WriteTetrahedralMeshFile(unsigned int n)
+{
+  const std::string file_name =
+    TemporaryFilePath("opensn_bench_tets_" + std::to_string(n) + ".msh");
+
+  if (mpi_comm.rank() == 0)
+  {
+    std::ofstream file(file_name, std::ofstream::out | std::ofstream::trunc);
+    if (not file.is_open())
+      throw std::runtime_error("Unable to open " + file_name + ".");
+
+    const unsigned int num_nodes_per_dim = n + 1;
+    auto NodeID = [num_nodes_per_dim](unsigned int i, unsigned int j, unsigned int k)
+    { return i + num_nodes_per_dim * (j + num_nodes_per_dim * k); };
+    auto NodePosition = [n, num_nodes_per_dim](size_t id)
+    {
+      const size_t i = id % num_nodes_per_dim;
+      const size_t j = (id / num_nodes_per_dim) % num_nodes_per_dim;
+      const size_t k = id / num_nodes_per_dim / num_nodes_per_dim;
+      return Vector3(i, j, k) / static_cast<double>(n);
+    };
+
+    const size_t num_nodes = static_cast<size_t>(num_nodes_per_dim) * num_nodes_per_dim *
+                             num_nodes_per_dim;
+    file << "$MeshFormat\n2.2 0 8\n$EndMeshFormat\n";
+    file << "$Nodes\n" << num_nodes << "\n";
+    for (size_t id = 0; id < num_nodes; ++id)
+    {
+      const auto x = NodePosition(id);
+      file << id + 1 << " " << x.x << " " << x.y << " " << x.z << "\n";
+    }
+    file << "$EndNodes\n";
+
+    // The six paths from corner (0,0,0) to corner (1,1,1) of a hexahedron along its edges
+    const std::array<std::array<int, 3>, 6> axis_orders = {
+      {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}}};
+
+    file << "$Elements\n" << 6 * static_cast<size_t>(n) * n * n << "\n";
+    size_t element_id = 1;
+    for (unsigned int k = 0; k < n; ++k)
+      for (unsigned int j = 0; j < n; ++j)
+        for (unsigned int i = 0; i < n; ++i)
+          for (const auto& axis_order : axis_orders)
+          {
+            std::array<unsigned int, 3> ijk = {i, j, k};
+            std::array<unsigned int, 4> nodes{};
+            nodes[0] = NodeID(ijk[0], ijk[1], ijk[2]);
+            for (int v = 0; v < 3; ++v)
+            {
+              ++ijk[axis_order[v]];
+              nodes[v + 1] = NodeID(ijk[0], ijk[1], ijk[2]);
+            }
+
+            // Gmsh tetrahedra are positively oriented
+            const auto x0 = NodePosition(nodes[0]);
+            const auto x1 = NodePosition(nodes[1]);
+            const auto x2 = NodePosition(nodes[2]);
+            const auto x3 = NodePosition(nodes[3]);
+            if ((x1 - x0).Cross(x2 - x0).Dot(x3 - x0) < 0.0)
+              std::swap(nodes[1], nodes[2]);
+
+            file << element_id++ << " 4 2 0 1";
+            for (const auto node : nodes)
+              file << " " << node + 1;
+            file << "\n";
+          }
+    file << "$EndElements\n";
+  }
+  mpi_comm.barrier();
+
+  return file_name;
+}
+
+/**
+ * Writes a synthetic cross-section file in OpenSn format. Every group scatters into itself and
+ * into the next group, and the higher scattering moments are scaled copies of the isotropic one,
+ * which gives the transfer matrices the sparsity of a typical downscattering library. Only
+ * location 0 writes the file. Collective.
+ */
+std::string
+WriteCrossSectionFile(unsigned int num_groups, unsigned int scattering_order)
+{
+  const std::string file_name = TemporaryFilePath("opensn_bench_" + std::to_string(num_groups) +
+                                                  "g_p" + std::to_string(scattering_order) +
+                                                  ".xs");
+
+  if (mpi_comm.rank() == 0)
+  {
+    std::ofstream file(file_name, std::ofstream::out | std::ofstream::trunc);
+    if (not file.is_open())
+      throw std::runtime_error("Unable to open " + file_name + ".");
+
+    auto SigmaT = [](unsigned int g) { return 1.0 + 0.01 * g; };
+
+    file << "NUM_GROUPS " << num_groups << "\n";
+    file << "NUM_MOMENTS " << scattering_order + 1 << "\n\n";
+
+    file << "SIGMA_T_BEGIN\n";
+    for (unsigned int g = 0; g < num_groups; ++g)
+      file << g << " " << SigmaT(g) << "\n";
+    file << "SIGMA_T_END\n\n";
+
+    file << "TRANSFER_MOMENTS_BEGIN\n";
+    for (unsigned int ell = 0; ell <= scattering_order; ++ell)
+    {
+      const double scale = 1.0 / (1.0 + ell);
+      for (unsigned int gp = 0; gp < num_groups; ++gp)
+      {
+        file << "M_GPRIME_G_VAL " << ell << " " << gp << " " << gp << " "
+             << 0.5 * scale * SigmaT(gp) << "\n";
+        if (gp + 1 < num_groups)
+          file << "M_GPRIME_G_VAL " << ell << " " << gp << " " << gp + 1 << " "
+               << 0.2 * scale * SigmaT(gp) << "\n";
+      }
+    }
+    file << "TRANSFER_MOMENTS_END\n";
+  }
+  mpi_comm.barrier();
+
+  return file_name;
+}
+
+/// Builds a unit-cube mesh with `n` hexahedra along each axis and makes it the current mesh.
+void
+MakeCubeMesh(MeshType mesh_type, unsigned int n)
+{
+  if (mesh_type == MeshType::ORTHOGONAL)
+  {
+    std::vector<double> nodes(n + 1);
+    for (unsigned int i = 0; i <= n; ++i)
+      nodes[i] = static_cast<double>(i) / n;
+
+    ParameterBlock node_sets("node_sets");
+    for (int d = 0; d < 3; ++d)
+      node_sets.AddParameter(std::to_string(d), nodes);
+    node_sets.ChangeToArray();
+
+    ParameterBlock block;
+    block.AddParameter(node_sets);
+
+    auto params = OrthogonalMeshGenerator::GetInputParameters();
+    params.AssignParameters(block);
+    OrthogonalMeshGenerator generator(params);
+    generator.Execute();
+  }
+  else
+  {
+    ParameterBlock block;
+    block.AddParameter("filename", WriteTetrahedralMeshFile(n));
+
+    auto params = FromFileMeshGenerator::GetInputParameters();
+    params.AssignParameters(block);
+    FromFileMeshGenerator generator(params);
+    generator.Execute();
+  }
+
+  GetCurrentMesh()->SetUniformMaterialID(0);
+}
+
+/// Adds material 0 with synthetic cross sections and a unit isotropic source.
+void
+MakeMaterial(unsigned int num_groups, unsigned int scattering_order)
+{
+  auto xs = std::make_shared<MultiGroupXS>();
+  xs->Initialize(WriteCrossSectionFile(num_groups, scattering_order));
+
+  auto source = std::make_shared<IsotropicMultiGroupSource>();
+  source->source_value_g.assign(num_groups, 1.0);
+
+  auto material = std::make_shared<Material>();
+  material->name = "Benchmark Material";
+  material->properties.push_back(xs);
+  material->properties.push_back(source);
+  material_stack.push_back(material);
+}
+
+} // namespace
+
+bool
+TransportProblemSpec::operator==(const TransportProblemSpec& other) const
+{
+  return mesh_type == other.mesh_type and sweep_type == other.sweep_type and
+         num_cells_per_dim == other.num_cells_per_dim and num_groups == other.num_groups and
+         num_polar == other.num_polar and num_azimuthal == other.num_azimuthal and
+         scattering_order == other.scattering_order;
+}
+
+std::shared_ptr<BenchTransportSolver>
+MakeTransportProblem(const TransportProblemSpec& spec)
+{
+  MakeCubeMesh(spec.mesh_type, spec.num_cells_per_dim);
+  MakeMaterial(spec.num_groups, spec.scattering_order);
+
+  angular_quadrature_stack.push_back(
+    std::make_shared<AngularQuadratureProdGLC>(spec.num_azimuthal, spec.num_polar));
+  const size_t quadrature_handle = angular_quadrature_stack.size() - 1;
+
+  ParameterBlock groupset("0");
+  groupset.AddParameter("groups_from_to",
+                        std::vector<size_t>{0, static_cast<size_t>(spec.num_groups) - 1});
+  groupset.AddParameter("angular_quadrature_handle", quadrature_handle);
+
+  ParameterBlock groupsets("groupsets");
+  groupsets.AddParameter(groupset);
+  groupsets.ChangeToArray();
+
+  ParameterBlock options("options");
+  options.AddParameter("scattering_order", static_cast<int>(spec.scattering_order));
+
+  ParameterBlock block;
+  block.AddParameter("name", std::string("BenchTransportSolver"));
+  block.AddParameter("num_groups", static_cast<size_t>(spec.num_groups));
+  block.AddParameter("sweep_type", spec.sweep_type);
+  block.AddParameter(groupsets);
+  block.AddParameter(options);
+
+  auto params = DiscreteOrdinatesSolver::GetInputParameters();
+  params.AssignParameters(block);
+  auto solver = std::make_shared<BenchTransportSolver>(params);
+  solver->Initialize();
+
+  return solver;
+}
+
+BenchTransportSolver&
+GetTransportProblem(const TransportProblemSpec& spec)
+{
+  if (cached_problem and cached_spec == spec)
+    return *cached_problem;
+
+  ReleaseTransportProblem();
+  cached_problem = MakeTransportProblem(spec);
+  cached_spec = spec;
+  return *cached_problem;
+}
+
+void
+ReleaseTransportProblem()
+{
+  cached_problem.reset();
+  field_function_stack.clear();
+  angular_quadrature_stack.clear();
+  material_stack.clear();
+  mesh_stack.clear();
+#ifdef __GLIBC__
+  // Return the freed memory to the system so that it does not count towards the next benchmark
+  malloc_trim(0);
+#endif
+}
+
+double
+MaxOverLocations(double value)
+{
+  double max_value = 0.0;
+  mpi_comm.all_reduce(value, max_value, mpi::op::max<double>());
+  return max_value;
+}
+
+double
+SumOverLocations(double value)
+{
+  double sum = 0.0;
+  mpi_comm.all_reduce(value, sum, mpi::op::sum<double>());
+  return sum;
+}
+
+bool
+ResetPeakResidentMemory()
+{
+#ifdef __linux__
+  // Writing 5 to clear_refs resets the peak resident set size (VmHWM) to the current one
+  std::ofstream file("/proc/self/clear_refs");
+  file << "5" << std::flush;
+  return file.good();
+#else
+  return false;
+#endif
+}
+
+double
+PeakResidentMemory()
+{
+#ifdef __linux__
+  // Reported in kibibytes
+  std::ifstream file("/proc/self/status");
+  std::string line;
+  while (std::getline(file, line))
+    if (line.rfind("VmHWM:", 0) == 0)
+      return std::stod(line.substr(6)) / 1024.0;
+#endif
+
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  // Reported in bytes on macOS
+  return static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0);
+#else
+  // Reported in kibibytes on Linux
+  return static_cast<double>(usage.ru_maxrss) / 1024.0;
+#endif
+}
+
+void
+SetCounters(benchmark::State& state, double total_time, double num_global_unknowns)
+{
+  const double num_unknowns_processed =
+    num_global_unknowns * static_cast<double>(state.iterations());
+  if (num_unknowns_processed > 0.0)
+    state.counters["ns_per_unknown"] =
+      total_time * 1.0e9 * mpi_comm.size() / num_unknowns_processed;
+  state.counters["peak_memory_MiB"] = MaxOverLocations(PeakResidentMemory());
+}
+
+} // namespace bench
@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/lbs_discrete_ordinates_solver.h"
+#include "framework/runtime.h"
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <memory>
+#include <string>
+
+namespace bench
+{
+
+/// Cell types of the synthetic benchmark meshes.
+enum class MeshType : int
+{
+  ORTHOGONAL = 0, ///< Hexahedra
+  TETRAHEDRAL = 1 ///< Every hexahedron split into six tetrahedra
+};
+
+/// Describes a synthetic transport problem on a unit cube.
+struct TransportProblemSpec
+{
+  MeshType mesh_type = MeshType::ORTHOGONAL;
+  std::string sweep_type = "AAH";
+  /// Number of hexahedra along each axis.
+  unsigned int num_cells_per_dim = 8;
+  unsigned int num_groups = 1;
+  /// Number of polar angles per hemisphere of the product quadrature.
+  unsigned int num_polar = 2;
+  /// Number of azimuthal angles per octant of the product quadrature.
+  unsigned int num_azimuthal = 2;
+  unsigned int scattering_order = 1;
+
+  bool operator==(const TransportProblemSpec& other) const;
+};
+
+/// Discrete ordinates solver with its sweep setup exposed to the benchmarks.
+class BenchTransportSolver : public opensn::DiscreteOrdinatesSolver
+{
+public:
+  using DiscreteOrdinatesSolver::DiscreteOrdinatesSolver;
+  using DiscreteOrdinatesSolver::InitializeSweepDataStructures;
+};
+
+/**
+ * Builds and initializes the transport problem described by `spec`: the mesh, a single material
+ * with synthetic cross sections and a unit isotropic source, and a solver with one groupset and
+ * vacuum boundaries. Collective.
+ */
+std::shared_ptr<BenchTransportSolver> MakeTransportProblem(const TransportProblemSpec& spec);
+
+/**
+ * Returns the transport problem described by `spec`. The last problem built is cached so that the
+ * repeated invocations of a benchmark do not rebuild it, and released before another problem is
+ * built so that benchmarks on smaller problems do not keep the memory of larger ones resident.
+ * Collective.
+ */
+BenchTransportSolver& GetTransportProblem(const TransportProblemSpec& spec);
+
+/// Releases the cached transport problem and everything it put on the global stacks.
+void ReleaseTransportProblem();
+
+/// Returns the longest of the values over all locations.
+double MaxOverLocations(double value);
+
+/// Returns the sum of the values over all locations.
+double SumOverLocations(double value);
+
+/**
+ * Resets the peak resident memory of this process to its current resident memory, so that
+ * PeakResidentMemory measures the benchmark that follows. Returns false where the peak cannot be
+ * reset (systems other than Linux), in which case the peak covers the whole process lifetime.
+ */
+bool ResetPeakResidentMemory();
+
+/// Returns the peak resident memory of this process since the last reset, in MiB.
+double PeakResidentMemory();
+
+/**
+ * Adds the counters reported by every benchmark: the cost per unknown in nanoseconds, computed
+ * from the accumulated iteration time and the number of unknowns processed per iteration over all
+ * locations, and the peak resident memory of the most loaded location during the benchmark in
+ * MiB, which includes the problem it runs on. The cost is
+ * multiplied by the number of locations, i.e. it is measured in core-nanoseconds so that it stays
+ * comparable across process counts.
+ */
+void SetCounters(benchmark::State& state, double total_time, double num_global_unknowns);
+
+/**
+ * Runs the benchmark loop with manual timing. Every iteration is timed on all locations and the
+ * longest time is reported, so that all locations agree on the number of iterations and
+ * collective kernels can be benchmarked. Collective.
+ */
+template <typename Kernel>
+void
+RunTimed(benchmark::State& state, double num_global_unknowns, Kernel&& kernel)
+{
+  ResetPeakResidentMemory();
+  double total_time = 0.0;
+  for (auto _ : state)
+  {
+    opensn::mpi_comm.barrier();
+    const auto start = std::chrono::steady_clock::now();
+    kernel();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    const double time = MaxOverLocations(elapsed.count());
+    state.SetIterationTime(time);
+    total_time += time;
+  }
+  SetCounters(state, total_time, num_global_unknowns);
+}
+
+} // namespace bench
@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "bench/bench_utils.h"
+#include "framework/runtime.h"
+#include "mpicpp-lite/mpicpp-lite.h"
+#include "petsc.h"
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace mpi = mpicpp_lite;
+
+namespace
+{
+
+/// Discards the results on the locations that do not report.
+class NullReporter : public benchmark::BenchmarkReporter
+{
+public:
+  bool ReportContext(const Context&) override { return true; }
+  void ReportRuns(const std::vector<Run>&) override {}
+};
+
+bool
+HasArgument(const std::vector<char*>& args, const char* prefix)
+{
+  for (const auto arg : args)
+    if (std::strncmp(arg, prefix, std::strlen(prefix)) == 0)
+      return true;
+  return false;
+}
+
+} // namespace
+
+/**
+ * Benchmark suite entry point. Accepts the Google Benchmark command line options and runs on any
+ * number of processes, e.g. `mpirun -np 4 opensn-bench --benchmark_filter=Sweep`. Location 0
+ * prints the results and writes them as JSON to `opensn-bench.json`, unless another output file
+ * is given with `--benchmark_out`.
+ */
+int
+main(int argc, char** argv)
+{
+  mpi::Environment env(argc, argv);
+  opensn::mpi_comm = mpi::Communicator(MPI_COMM_WORLD);
+
+  PetscOptionsInsertString(nullptr, "-error_output_stderr");
+  PetscOptionsInsertString(nullptr, "-no_signal_handler");
+  PetscInitializeNoArguments();
+  opensn::Initialize();
+
+  const bool is_reporting = opensn::mpi_comm.rank() == 0;
+
+  std::string default_out = "--benchmark_out=opensn-bench.json";
+  std::string default_out_format = "--benchmark_out_format=json";
+  std::vector<char*> args;
+  for (int i = 0; i < argc; ++i)
+  {
+    // Only the reporting location writes an output file
+    if (not is_reporting and std::strncmp(argv[i], "--benchmark_out", 15) == 0)
+      continue;
+    args.push_back(argv[i]);
+  }
+  if (is_reporting and not HasArgument(args, "--benchmark_out="))
+  {
+    args.push_back(default_out.data());
+    if (not HasArgument(args, "--benchmark_out_format="))
+      args.push_back(default_out_format.data());
+  }
+
+  int num_args = static_cast<int>(args.size());
+  benchmark::Initialize(&num_args, args.data());
+  if (benchmark::ReportUnrecognizedArguments(num_args, args.data()))
+  {
+    opensn::Finalize();
+    PetscFinalize();
+    return 1;
+  }
+
+  if (is_reporting)
+    benchmark::RunSpecifiedBenchmarks();
+  else
+  {
+    NullReporter reporter;
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+  }
+
+  bench::ReleaseTransportProblem();
+  opensn::Finalize();
+  PetscFinalize();
+
+  return 0;
+}
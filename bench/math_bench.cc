@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "bench/bench_utils.h"
+#include "framework/math/dense_matrix.h"
+#include "framework/math/vector.h"
+#include "framework/math/vector_ghost_communicator/vector_ghost_communicator.h"
+#include <algorithm>
+
+using namespace opensn;
+
+namespace bench
+{
+
+namespace
+{
+
+/// Number of systems solved per iteration of the Gauss elimination benchmarks.
+constexpr size_t num_systems = 1024;
+
+/// Returns the entry (i, j) of a diagonally dominant test matrix of size n.
+double
+TestMatrixEntry(unsigned int i, unsigned int j, unsigned int n)
+{
+  return i == j ? 2.0 * n : 1.0 / (1.0 + i + j);
+}
+
+/**
+ * Solves small dense systems one at a time, as done for cell systems in the sweep. The cost is per
+ * unknown and includes restoring the system before every solve.
+ */
+void
+BM_GaussElimination(benchmark::State& state)
+{
+  const auto n = static_cast<unsigned int>(state.range(0));
+
+  std::vector<double> A0(num_systems * n * n);
+  std::vector<double> b0(num_systems * n, 1.0);
+  for (size_t s = 0; s < num_systems; ++s)
+    for (unsigned int i = 0; i < n; ++i)
+      for (unsigned int j = 0; j < n; ++j)
+        A0[(s * n + i) * n + j] = TestMatrixEntry(i, j, n);
+
+  DenseMatrix<double> A(n, n);
+  Vector<double> b(n);
+
+  const double num_unknowns = SumOverLocations(static_cast<double>(num_systems * n));
+  RunTimed(state,
+           num_unknowns,
+           [&]
+           {
+             for (size_t s = 0; s < num_systems; ++s)
+             {
+               std::copy_n(A0.data() + s * n * n, n * n, A.data());
+               std::copy_n(b0.data() + s * n, n, b.data());
+               GaussElimination(A, b, n);
+               benchmark::DoNotOptimize(b.data());
+             }
+           });
+}
+
+/**
+ * Solves the same systems as BM_GaussElimination with the batched, batch-innermost variant. The
+ * cost is per unknown and includes restoring the systems before every solve.
+ */
+void
+BM_BatchedGaussElimination(benchmark::State& state)
+{
+  const auto n = static_cast<unsigned int>(state.range(0));
+
+  std::vector<double> A0(n * n * num_systems);
+  std::vector<double> b0(n * num_systems, 1.0);
+  for (unsigned int i = 0; i < n; ++i)
+    for (unsigned int j = 0; j < n; ++j)
+      std::fill_n(A0.data() + (i * n + j) * num_systems, num_systems, TestMatrixEntry(i, j, n));
+
+  std::vector<double> A(A0.size());
+  std::vector<double> b(b0.size());
+
+  const double num_unknowns = SumOverLocations(static_cast<double>(num_systems * n));
+  RunTimed(state,
+           num_unknowns,
+           [&]
+           {
+             std::copy(A0.begin(), A0.end(), A.begin());
+             std::copy(b0.begin(), b0.end(), b.begin());
+             BatchedGaussEliminationDispatch(A.data(), b.data(), n, num_systems);
+             benchmark::DoNotOptimize(b.data());
+           });
+}
+
+/**
+ * Updates the ghost entries of a vector distributed evenly over all locations. Every location
+ * ghosts entries from the start of the next location and the end of the previous one. The cost is
+ * per ghost entry.
+ */
+void
+BM_GhostCommunication(benchmark::State& state)
+{
+  const auto local_size = static_cast<uint64_t>(state.range(0));
+  const auto num_ghosts = std::min(static_cast<uint64_t>(state.range(1)), local_size);
+  const int location_id = mpi_comm.rank();
+  const int num_locations = mpi_comm.size();
+  const uint64_t global_size = local_size * num_locations;
+
+  std::vector<int64_t> ghost_ids;
+  if (num_locations > 1)
+  {
+    const uint64_t next_start = local_size * ((location_id + 1) % num_locations);
+    const uint64_t prev_end = local_size * ((location_id + num_locations - 1) % num_locations + 1);
+    for (uint64_t i = 0; i < num_ghosts / 2; ++i)
+      ghost_ids.push_back(static_cast<int64_t>(next_start + i));
+    for (uint64_t i = num_ghosts / 2; i < num_ghosts; ++i)
+      ghost_ids.push_back(static_cast<int64_t>(prev_end - num_ghosts + i));
+  }
+
+  VectorGhostCommunicator communicator(local_size, global_size, ghost_ids, mpi_comm);
+  auto x = communicator.MakeGhostedVector();
+  std::fill_n(x.begin(), local_size, static_cast<double>(location_id));
+
+  const double num_unknowns = SumOverLocations(static_cast<double>(ghost_ids.size()));
+  RunTimed(state, num_unknowns, [&] { communicator.CommunicateGhostEntries(x); });
+}
+
+} // namespace
+
+BENCHMARK(BM_GaussElimination)
+  ->ArgName("n")
+  ->Arg(4)
+  ->Arg(8)
+  ->Arg(16)
+  ->UseManualTime()
+  ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_BatchedGaussElimination)
+  ->ArgName("n")
+  ->Arg(4)
+  ->Arg(8)
+  ->Arg(16)
+  ->UseManualTime()
+  ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_GhostCommunication)
+  ->ArgNames({"local_size", "ghosts"})
+  ->ArgsProduct({{1 << 16, 1 << 20}, {1 << 8, 1 << 12}})
+  ->UseManualTime()
+  ->Unit(benchmark::kMicrosecond);
+
+} // namespace bench
@@ -0,0 +1,293 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "bench/bench_utils.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/mesh/mesh.h"
+#include <algorithm>
+#include <map>
+#include <memory>
+
+using namespace opensn;
+
+namespace bench
+{
+
+namespace
+{
+
+/// Returns the mesh of a one-group problem with `state.range(0)` cells along each axis.
+const MeshContinuum&
+GetCubeMesh(const benchmark::State& state, MeshType mesh_type)
+{
+  TransportProblemSpec spec;
+  spec.mesh_type = mesh_type;
+  spec.num_cells_per_dim = static_cast<unsigned int>(state.range(0));
+  GetTransportProblem(spec);
+  return *GetCurrentMesh();
+}
+
+/**
+ * Looks up the neighbors of every local cell by global id, local and ghost alike, in the order the
+ * sweep setup and the spatial discretizations visit them. The cost is per lookup.
+ */
+void
+BM_GlobalCellLookup(benchmark::State& state, MeshType mesh_type)
+{
+  const auto& grid = GetCubeMesh(state, mesh_type);
+
+  std::vector<uint64_t> neighbor_ids;
+  for (const auto& cell : grid.local_cells)
+    for (const auto& face : cell.faces)
+      if (face.has_neighbor)
+        neighbor_ids.push_back(face.neighbor_id);
+
+  const double num_unknowns = SumOverLocations(static_cast<double>(neighbor_ids.size()));
+  RunTimed(state,
+           num_unknowns,
+           [&]
+           {
+             uint64_t sum = 0;
+             for (uint64_t neighbor_id : neighbor_ids)
+               sum += grid.cells[neighbor_id].partition_id;
+             benchmark::DoNotOptimize(sum);
+           });
+}
+
+/**
+ * Looks up the vertices of every local cell by global id, in cell order. The cost is per lookup.
+ */
+void
+BM_GlobalVertexLookup(benchmark::State& state, MeshType mesh_type)
+{
+  const auto& grid = GetCubeMesh(state, mesh_type);
+
+  std::vector<uint64_t> vertex_ids;
+  for (const auto& cell : grid.local_cells)
+    vertex_ids.insert(vertex_ids.end(), cell.vertex_ids.begin(), cell.vertex_ids.end());
+
+  const double num_unknowns = SumOverLocations(static_cast<double>(vertex_ids.size()));
+  RunTimed(state,
+           num_unknowns,
+           [&]
+           {
+             Vector3 sum;
+             for (uint64_t vertex_id : vertex_ids)
+               sum += grid.vertices[vertex_id];
+             benchmark::DoNotOptimize(sum);
+           });
+}
+
+/**
+ * The block of hexahedra owned by this location in an (n P) x n x n grid of unit-cube cells, where
+ * P is the number of locations and every location owns n consecutive layers along x. The global
+ * ids of a block are strided like those of a partitioned mesh.
+ */
+struct HexBlockPartition
+{
+  explicit HexBlockPartition(unsigned int n)
+    : n(n),
+      num_cells_x(static_cast<uint64_t>(n) * mpi_comm.size()),
+      i_begin(static_cast<uint64_t>(n) * mpi_comm.rank()),
+      i_end(i_begin + n)
+  {
+  }
+
+  uint64_t CellID(uint64_t i, uint64_t j, uint64_t k) const
+  {
+    return i + num_cells_x * (j + static_cast<uint64_t>(n) * k);
+  }
+
+  uint64_t VertexID(uint64_t i, uint64_t j, uint64_t k) const
+  {
+    return i + (num_cells_x + 1) * (j + (static_cast<uint64_t>(n) + 1) * k);
+  }
+
+  /// First and one-past-last x index of the cells stored here, i.e. including the ghost layers.
+  uint64_t StoredBegin() const { return i_begin > 0 ? i_begin - 1 : 0; }
+  uint64_t StoredEnd() const { return std::min(i_end + 1, num_cells_x); }
+
+  const unsigned int n;
+  const uint64_t num_cells_x;
+  const uint64_t i_begin;
+  const uint64_t i_end;
+};
+
+/// Builds the mesh containers through the MeshContinuum handlers, which index with IndexMap.
+class IndexMapMesh
+{
+public:
+  void ReserveVertices(size_t num_vertices) { grid_->vertices.Reserve(num_vertices); }
+  void InsertVertex(uint64_t id, const Vector3& vertex) { grid_->vertices.Insert(id, vertex); }
+  void AddCell(std::unique_ptr<Cell> cell) { grid_->cells.push_back(std::move(cell)); }
+  const Cell& GetCell(uint64_t id) const { return grid_->cells[id]; }
+  const Vector3& GetVertex(uint64_t id) const { return grid_->vertices[id]; }
+
+private:
+  std::shared_ptr<MeshContinuum> grid_ = MeshContinuum::New();
+};
+
+/// Baseline with the std::map indices that the MeshContinuum handlers used before IndexMap.
+class StdMapMesh
+{
+public:
+  void ReserveVertices(size_t) {}
+  void InsertVertex(uint64_t id, const Vector3& vertex) { vertices_.insert({id, vertex}); }
+
+  void AddCell(std::unique_ptr<Cell> cell)
+  {
+    if (cell->partition_id == static_cast<uint64_t>(mpi_comm.rank()))
+    {
+      cell->local_id = local_cells_.size();
+      local_cell_ids_.insert({cell->global_id, local_cells_.size()});
+      local_cells_.push_back(std::move(cell));
+    }
+    else
+    {
+      ghost_cell_ids_.insert({cell->global_id, ghost_cells_.size()});
+      ghost_cells_.push_back(std::move(cell));
+    }
+  }
+
+  const Cell& GetCell(uint64_t id) const
+  {
+    const auto local = local_cell_ids_.find(id);
+    if (local != local_cell_ids_.end())
+      return *local_cells_[local->second];
+    return *ghost_cells_[ghost_cell_ids_.at(id)];
+  }
+
+  const Vector3& GetVertex(uint64_t id) const { return vertices_.at(id); }
+
+private:
+  std::map<uint64_t, Vector3> vertices_;
+  std::vector<std::unique_ptr<Cell>> local_cells_;
+  std::vector<std::unique_ptr<Cell>> ghost_cells_;
+  std::map<uint64_t, uint64_t> local_cell_ids_;
+  std::map<uint64_t, uint64_t> ghost_cell_ids_;
+};
+
+/**
+ * Fills the vertex and cell containers of a block of hexahedra and its ghost layers, then resolves
+ * the face neighbors and vertices of every local cell by global id, as mesh setup does.
+ */
+template <typename Mesh>
+void
+BuildHexBlock(const HexBlockPartition& partition)
+{
+  const uint64_t n = partition.n;
+  Mesh mesh;
+
+  mesh.ReserveVertices((partition.StoredEnd() - partition.StoredBegin() + 1) * (n + 1) * (n + 1));
+  for (uint64_t k = 0; k <= n; ++k)
+    for (uint64_t j = 0; j <= n; ++j)
+      for (uint64_t i = partition.StoredBegin(); i <= partition.StoredEnd(); ++i)
+        mesh.InsertVertex(partition.VertexID(i, j, k), Vector3(i, j, k) / static_cast<double>(n));
+
+  for (uint64_t k = 0; k < n; ++k)
+    for (uint64_t j = 0; j < n; ++j)
+      for (uint64_t i = partition.StoredBegin(); i < partition.StoredEnd(); ++i)
+      {
+        auto cell = std::make_unique<Cell>(CellType::POLYHEDRON, CellType::HEXAHEDRON);
+        cell->global_id = partition.CellID(i, j, k);
+        cell->partition_id = i / n;
+        for (uint64_t dk = 0; dk < 2; ++dk)
+          for (uint64_t dj = 0; dj < 2; ++dj)
+            for (uint64_t di = 0; di < 2; ++di)
+              cell->vertex_ids.push_back(partition.VertexID(i + di, j + dj, k + dk));
+        mesh.AddCell(std::move(cell));
+      }
+
+  uint64_t num_remote_neighbors = 0;
+  Vector3 centroid_sum;
+  for (uint64_t k = 0; k < n; ++k)
+    for (uint64_t j = 0; j < n; ++j)
+      for (uint64_t i = partition.i_begin; i < partition.i_end; ++i)
+      {
+        const auto& cell = mesh.GetCell(partition.CellID(i, j, k));
+        for (uint64_t vid : cell.vertex_ids)
+          centroid_sum += mesh.GetVertex(vid);
+
+        auto Visit = [&](uint64_t ni, uint64_t nj, uint64_t nk)
+        {
+          if (mesh.GetCell(partition.CellID(ni, nj, nk)).partition_id != cell.partition_id)
+            ++num_remote_neighbors;
+        };
+        if (i > 0)
+          Visit(i - 1, j, k);
+        if (i + 1 < partition.num_cells_x)
+          Visit(i + 1, j, k);
+        if (j > 0)
+          Visit(i, j - 1, k);
+        if (j + 1 < n)
+          Visit(i, j + 1, k);
+        if (k > 0)
+          Visit(i, j, k - 1);
+        if (k + 1 < n)
+          Visit(i, j, k + 1);
+      }
+
+  benchmark::DoNotOptimize(num_remote_neighbors);
+  benchmark::DoNotOptimize(centroid_sum);
+}
+
+/**
+ * Builds the cell and vertex containers of a block of `state.range(0)` cubed hexahedra per
+ * location and resolves the neighbors and vertices of its cells. Compares the IndexMap-based
+ * MeshContinuum handlers with the std::map baseline. The cost is per local cell.
+ */
+template <typename Mesh>
+void
+BM_MeshHandlerSetup(benchmark::State& state)
+{
+  const HexBlockPartition partition(static_cast<unsigned int>(state.range(0)));
+  const double num_unknowns =
+    SumOverLocations(static_cast<double>(partition.n) * partition.n * partition.n);
+  RunTimed(state, num_unknowns, [&] { BuildHexBlock<Mesh>(partition); });
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_GlobalCellLookup, orthogonal, MeshType::ORTHOGONAL)
+  ->ArgName("cells_per_dim")
+  ->Arg(16)
+  ->Arg(32)
+  ->UseManualTime()
+  ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_GlobalCellLookup, tetrahedral, MeshType::TETRAHEDRAL)
+  ->ArgName("cells_per_dim")
+  ->Arg(8)
+  ->Arg(16)
+  ->UseManualTime()
+  ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_GlobalVertexLookup, orthogonal, MeshType::ORTHOGONAL)
+  ->ArgName("cells_per_dim")
+  ->Arg(16)
+  ->Arg(32)
+  ->UseManualTime()
+  ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_GlobalVertexLookup, tetrahedral, MeshType::TETRAHEDRAL)
+  ->ArgName("cells_per_dim")
+  ->Arg(8)
+  ->Arg(16)
+  ->UseManualTime()
+  ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MeshHandlerSetup, IndexMapMesh)
+  ->ArgName("cells_per_dim")
+  ->Arg(64)
+  ->Arg(128)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_MeshHandlerSetup, StdMapMesh)
+  ->ArgName("cells_per_dim")
+  ->Arg(64)
+  ->Arg(128)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
+
+} // namespace bench
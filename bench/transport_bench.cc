@@ -0,0 +1,151 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "bench/bench_utils.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/iterative_methods/sweep_wgs_context.h"
+#include "framework/math/spatial_discretization/spatial_discretization.h"
+
+using namespace opensn;
+
+namespace bench
+{
+
+namespace
+{
+
+/**
+ * Reads the problem size from the benchmark arguments: the number of hexahedra along each axis,
+ * the number of groups, and the number of polar and azimuthal angles per octant.
+ */
+TransportProblemSpec
+MakeSpec(const benchmark::State& state, MeshType mesh_type, const std::string& sweep_type)
+{
+  TransportProblemSpec spec;
+  spec.mesh_type = mesh_type;
+  spec.sweep_type = sweep_type;
+  spec.num_cells_per_dim = static_cast<unsigned int>(state.range(0));
+  spec.num_groups = static_cast<unsigned int>(state.range(1));
+  spec.num_polar = static_cast<unsigned int>(state.range(2));
+  spec.num_azimuthal = static_cast<unsigned int>(state.range(2));
+  return spec;
+}
+
+/// Returns the number of spatial nodes over all locations.
+double
+NumGlobalNodes(const BenchTransportSolver& solver)
+{
+  const auto& sdm = solver.SpatialDiscretization();
+  return SumOverLocations(static_cast<double>(sdm.GetNumLocalDOFs(sdm.UNITARY_UNKNOWN_MANAGER)));
+}
+
+/// Sweeps a fixed source. The cost is per node, direction and group.
+void
+BM_Sweep(benchmark::State& state, MeshType mesh_type, const std::string& sweep_type)
+{
+  auto& solver = GetTransportProblem(MakeSpec(state, mesh_type, sweep_type));
+  auto& groupset = solver.Groupsets().front();
+  auto& context = dynamic_cast<SweepWGSContext&>(solver.GetWGSContext(groupset.id));
+
+  auto& q = solver.QMomentsLocal();
+  q.assign(q.size(), 0.0);
+  context.set_source_function(groupset, q, solver.PhiOldLocal(), APPLY_FIXED_SOURCES);
+
+  const double num_unknowns = NumGlobalNodes(solver) *
+                              static_cast<double>(groupset.quadrature->omegas.size()) *
+                              static_cast<double>(groupset.groups.size());
+
+  RunTimed(
+    state, num_unknowns, [&] { context.ApplyInverseTransportOperator(APPLY_FIXED_SOURCES); });
+}
+
+/**
+ * Evaluates the fixed, within-groupset and across-groupset scattering sources. The cost is per
+ * node, moment and group.
+ */
+void
+BM_SourceFunction(benchmark::State& state)
+{
+  auto& solver = GetTransportProblem(MakeSpec(state, MeshType::ORTHOGONAL, "AAH"));
+  const auto& groupset = solver.Groupsets().front();
+  const auto set_source_function = solver.GetActiveSetSourceFunction();
+
+  auto& phi = solver.PhiOldLocal();
+  phi.assign(phi.size(), 1.0);
+  auto& q = solver.QMomentsLocal();
+
+  const double num_unknowns = NumGlobalNodes(solver) * static_cast<double>(solver.NumMoments()) *
+                              static_cast<double>(solver.NumGroups());
+
+  const auto scope = APPLY_FIXED_SOURCES | APPLY_WGS_SCATTER_SOURCES | APPLY_AGS_SCATTER_SOURCES;
+  RunTimed(state, num_unknowns, [&] { set_source_function(groupset, q, phi, scope); });
+}
+
+/**
+ * Builds the sweep plans (SPDS) and the FLUDS common data of all anglesets. The cost is per node
+ * and direction. The problem is built for this benchmark only, since rebuilding the sweep data
+ * structures invalidates the anglesets of the solver.
+ */
+void
+BM_SweepSetup(benchmark::State& state, MeshType mesh_type, const std::string& sweep_type)
+{
+  ReleaseTransportProblem();
+  auto solver = MakeTransportProblem(MakeSpec(state, mesh_type, sweep_type));
+  const auto& groupset = solver->Groupsets().front();
+
+  const double num_unknowns =
+    NumGlobalNodes(*solver) * static_cast<double>(groupset.quadrature->omegas.size());
+
+  RunTimed(state, num_unknowns, [&] { solver->InitializeSweepDataStructures(); });
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_Sweep, aah_orthogonal, MeshType::ORTHOGONAL, "AAH")
+  ->ArgNames({"cells_per_dim", "groups", "angles_per_octant_dim"})
+  ->ArgsProduct({{8, 16}, {1, 16}, {2}})
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_Sweep, cbc_orthogonal, MeshType::ORTHOGONAL, "CBC")
+  ->ArgNames({"cells_per_dim", "groups", "angles_per_octant_dim"})
+  ->ArgsProduct({{8, 16}, {1, 16}, {2}})
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_Sweep, aah_tetrahedral, MeshType::TETRAHEDRAL, "AAH")
+  ->ArgNames({"cells_per_dim", "groups", "angles_per_octant_dim"})
+  ->ArgsProduct({{4, 8}, {1, 16}, {2}})
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_Sweep, cbc_tetrahedral, MeshType::TETRAHEDRAL, "CBC")
+  ->ArgNames({"cells_per_dim", "groups", "angles_per_octant_dim"})
+  ->ArgsProduct({{4, 8}, {1, 16}, {2}})
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_SourceFunction)
+  ->ArgNames({"cells_per_dim", "groups", "angles_per_octant_dim"})
+  ->ArgsProduct({{16}, {1, 16, 64}, {1}})
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_SweepSetup, aah_orthogonal, MeshType::ORTHOGONAL, "AAH")
+  ->ArgNames({"cells_per_dim", "groups", "angles_per_octant_dim"})
+  ->ArgsProduct({{8, 16}, {1}, {2}})
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_SweepSetup, cbc_orthogonal, MeshType::ORTHOGONAL, "CBC")
+  ->ArgNames({"cells_per_dim", "groups", "angles_per_octant_dim"})
+  ->ArgsProduct({{8, 16}, {1}, {2}})
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_SweepSetup, aah_tetrahedral, MeshType::TETRAHEDRAL, "AAH")
+  ->ArgNames({"cells_per_dim", "groups", "angles_per_octant_dim"})
+  ->ArgsProduct({{4, 8}, {1}, {2}})
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
+
+} // namespace bench
@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace opensn
+{
+
+/**
+ * Maps global ids to local storage indices with an open-addressing hash table.
+ *
+ * Keys and values live together in a single contiguous slot array that is probed linearly, so a
+ * lookup touches one or two cache lines instead of walking a tree. The table is kept at most half
+ * full. Entries can only be inserted or cleared, which is all the mesh containers need. The
+ * largest uint64_t value is reserved to mark empty slots and cannot be used as a key.
+ */
+class IndexMap
+{
+public:
+  IndexMap() = default;
+
+  /// Number of stored entries.
+  size_t Size() const { return size_; }
+
+  bool Empty() const { return size_ == 0; }
+
+  /// Removes all entries and releases the slot storage.
+  void Clear()
+  {
+    slots_.clear();
+    slots_.shrink_to_fit();
+    size_ = 0;
+  }
+
+  /// Sizes the table so that `num_entries` entries can be inserted without rehashing.
+  void Reserve(size_t num_entries)
+  {
+    size_t capacity = 16;
+    while (capacity < 2 * num_entries)
+      capacity *= 2;
+    if (capacity > slots_.size())
+      Rehash(capacity);
+  }
+
+  /**
+   * Inserts an entry. Like `std::map::insert`, the stored value is left unchanged when the key is
+   * already present. Returns true when the entry was inserted.
+   */
+  bool Insert(uint64_t key, uint64_t value)
+  {
+    if (key == empty_key)
+      throw std::invalid_argument("IndexMap: Key " + std::to_string(key) + " is reserved.");
+
+    if (2 * (size_ + 1) > slots_.size())
+      Rehash(slots_.empty() ? 16 : 2 * slots_.size());
+
+    const size_t mask = slots_.size() - 1;
+    for (size_t i = Hash(key) & mask;; i = (i + 1) & mask)
+    {
+      auto& slot = slots_[i];
+      if (slot.key == key)
+        return false;
+      if (slot.key == empty_key)
+      {
+        slot = {key, value};
+        ++size_;
+        return true;
+      }
+    }
+  }
+
+  /// Returns a pointer to the value stored for `key`, or nullptr when the key is not present.
+  const uint64_t* Find(uint64_t key) const
+  {
+    if (slots_.empty())
+      return nullptr;
+
+    const size_t mask = slots_.size() - 1;
+    for (size_t i = Hash(key) & mask;; i = (i + 1) & mask)
+    {
+      const auto& slot = slots_[i];
+      if (slot.key == key and key != empty_key)
+        return &slot.value;
+      if (slot.key == empty_key)
+        return nullptr;
+    }
+  }
+
+  bool Contains(uint64_t key) const { return Find(key) != nullptr; }
+
+  /// Returns the value stored for `key`. Throws std::out_of_range when the key is not present.
+  uint64_t At(uint64_t key) const
+  {
+    const auto value = Find(key);
+    if (not value)
+      throw std::out_of_range("IndexMap: Key " + std::to_string(key) + " not found.");
+    return *value;
+  }
+
+  /// Memory used by the slot storage, in bytes.
+  size_t MemoryUsage() const { return slots_.capacity() * sizeof(Slot); }
+
+private:
+  struct Slot
+  {
+    uint64_t key = empty_key;
+    uint64_t value = 0;
+  };
+
+  static constexpr uint64_t empty_key = std::numeric_limits<uint64_t>::max();
+
+  /// Mixes the key bits (splitmix64 finalizer) so that runs of consecutive ids spread out.
+  static uint64_t Hash(uint64_t key)
+  {
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return key;
+  }
+
+  void Rehash(size_t capacity)
+  {
+    std::vector<Slot> old_slots(capacity);
+    old_slots.swap(slots_);
+
+    const size_t mask = capacity - 1;
+    for (const auto& old_slot : old_slots)
+    {
+      if (old_slot.key == empty_key)
+        continue;
+      size_t i = Hash(old_slot.key) & mask;
+      while (slots_[i].key != empty_key)
+        i = (i + 1) & mask;
+      slots_[i] = old_slot;
+    }
+  }
+
+  std::vector<Slot> slots_;
+  size_t size_ = 0;
+};
+
+} // namespace opensn
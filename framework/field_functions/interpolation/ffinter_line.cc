@@ -9,6 +9,7 @@
 #include "framework/mesh/cell/cell.h"
 #include "framework/logging/log.h"
 #include "framework/runtime.h"
+#include <algorithm>
 #include <fstream>
 
 namespace opensn
@@ -36,21 +37,20 @@ FieldFunctionInterpolationLine::Initialize()
   const auto& sdm = ref_ff_->GetSpatialDiscretization();
   const auto& grid = sdm.Grid();
 
-  // Find local points and associated cells
-  auto estimated_local_size = number_of_points_ / opensn::mpi_comm.size();
-  local_interpolation_points_.reserve(estimated_local_size);
-  local_cells_.reserve(estimated_local_size);
-  for (const auto& cell : grid.local_cells)
+  // Find local points and associated cells. Point-cell pairs are kept in cell-major order.
+  const auto containing_cells = grid.FindContainingCells(tmp_points);
+  std::vector<std::pair<uint64_t, int>> cell_point_pairs;
+  for (int p = 0; p < number_of_points_; ++p)
+    for (const uint64_t cell_local_id : containing_cells[p])
+      cell_point_pairs.emplace_back(cell_local_id, p);
+  std::sort(cell_point_pairs.begin(), cell_point_pairs.end());
+
+  local_interpolation_points_.reserve(cell_point_pairs.size());
+  local_cells_.reserve(cell_point_pairs.size());
+  for (const auto& [cell_local_id, p] : cell_point_pairs)
   {
-    for (int p = 0; p < number_of_points_; ++p)
-    {
-      auto& point = tmp_points[p];
-      if (grid.CheckPointInsideCell(cell, point))
-      {
-        local_interpolation_points_.push_back(point);
-        local_cells_.push_back(cell.local_id);
-      }
-    }
+    local_interpolation_points_.push_back(tmp_points[p]);
+    local_cells_.push_back(cell_local_id);
   }
 
   log.Log0Verbose1() << "Finished initializing interpolator.";
@@ -22,8 +22,9 @@ FieldFunctionInterpolationPoint::Initialize()
 
   const auto& grid = field_functions_.front()->GetSpatialDiscretization().Grid();
   std::vector<uint64_t> cells_potentially_owning_point;
-  for (const auto& cell : grid.local_cells)
+  for (const uint64_t cell_local_id : grid.FindCandidateCells(point_of_interest_))
   {
+    const auto& cell = grid.local_cells[cell_local_id];
     const auto& vcc = cell.centroid;
     const auto& poi = point_of_interest_;
     const auto nudged_point = poi + 1.0e-6 * (vcc - poi);
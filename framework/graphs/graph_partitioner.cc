@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: MIT
 
 #include "framework/graphs/graph_partitioner.h"
+#include "framework/mesh/mesh.h"
+#include "framework/mpi/mpi_utils.h"
+#include "framework/runtime.h"
 
 namespace opensn
 {
@@ -18,4 +21,88 @@ GraphPartitioner::GraphPartitioner(const InputParameters& params) : Object(param
 {
 }
 
+std::vector<int64_t>
+GraphPartitioner::PartitionDistributed(const std::vector<std::vector<uint64_t>>& local_graph,
+                                       const std::vector<Vector3>& local_centroids,
+                                       int number_of_parts,
+                                       const std::vector<double>& local_row_weights,
+                                       const std::vector<std::vector<double>>& local_edge_weights)
+{
+  int has_row_weights = local_row_weights.empty() ? 0 : 1;
+  int has_edge_weights = local_edge_weights.empty() ? 0 : 1;
+  mpi_comm.all_reduce(has_row_weights, mpi::op::max<int>());
+  mpi_comm.all_reduce(has_edge_weights, mpi::op::max<int>());
+
+  // Send the rows to location 0. Each row is its size followed by its neighbors, and its data is
+  // the centroid followed by the optional weights.
+  std::map<int, std::vector<uint64_t>> rows_to_root;
+  std::map<int, std::vector<double>> data_to_root;
+  auto& rows = rows_to_root[0];
+  auto& data = data_to_root[0];
+  for (size_t r = 0; r < local_graph.size(); ++r)
+  {
+    rows.push_back(local_graph[r].size());
+    rows.insert(rows.end(), local_graph[r].begin(), local_graph[r].end());
+
+    data.push_back(local_centroids[r].x);
+    data.push_back(local_centroids[r].y);
+    data.push_back(local_centroids[r].z);
+    if (has_row_weights)
+      data.push_back(local_row_weights[r]);
+    if (has_edge_weights)
+      data.insert(data.end(), local_edge_weights[r].begin(), local_edge_weights[r].end());
+  }
+  const auto rows_on_root = MapAllToAll(rows_to_root);
+  const auto data_on_root = MapAllToAll(data_to_root);
+
+  // Partition on location 0 and send the partition ids back
+  std::map<int, std::vector<int64_t>> pids_from_root;
+  if (mpi_comm.rank() == 0)
+  {
+    std::vector<std::vector<uint64_t>> graph;
+    std::vector<Vector3> centroids;
+    std::vector<double> row_weights;
+    std::vector<std::vector<double>> edge_weights;
+    std::vector<std::pair<int, size_t>> location_num_rows;
+    for (const auto& [pid, pid_rows] : rows_on_root)
+    {
+      const auto& pid_data = data_on_root.at(pid);
+      size_t num_rows = 0;
+      size_t r = 0;
+      size_t d = 0;
+      while (r < pid_rows.size())
+      {
+        const auto row_size = pid_rows[r++];
+        graph.emplace_back(pid_rows.begin() + r, pid_rows.begin() + r + row_size);
+        r += row_size;
+
+        centroids.emplace_back(pid_data[d], pid_data[d + 1], pid_data[d + 2]);
+        d += 3;
+        if (has_row_weights)
+          row_weights.push_back(pid_data[d++]);
+        if (has_edge_weights)
+        {
+          edge_weights.emplace_back(pid_data.begin() + d, pid_data.begin() + d + row_size);
+          d += row_size;
+        }
+        ++num_rows;
+      }
+      location_num_rows.emplace_back(pid, num_rows);
+    }
+
+    const auto pids = Partition(graph, centroids, number_of_parts, row_weights, edge_weights);
+
+    size_t offset = 0;
+    for (const auto& [pid, num_rows] : location_num_rows)
+    {
+      pids_from_root[pid].assign(pids.begin() + offset, pids.begin() + offset + num_rows);
+      offset += num_rows;
+    }
+  }
+  const auto pids_on_location = MapAllToAll(pids_from_root);
+
+  const auto it = pids_on_location.find(0);
+  return it != pids_on_location.end() ? it->second : std::vector<int64_t>{};
+}
+
 } // namespace opensn
@@ -13,10 +13,42 @@ struct Vector3;
 class GraphPartitioner : public Object
 {
 public:
-  /// Given a graph. Returns the partition ids of each row in the graph.
+  /**
+   * Given a graph. Returns the partition ids of each row in the graph.
+   *
+   * \param graph Adjacency list of each row.
+   * \param centroids Centroid of each row.
+   * \param number_of_parts Number of partitions to create.
+   * \param row_weights Work estimate of each row. Empty means unit weights.
+   * \param edge_weights Communication weight of each edge, laid out like `graph`. Empty means
+   *        unit weights.
+   */
   virtual std::vector<int64_t> Partition(const std::vector<std::vector<uint64_t>>& graph,
                                          const std::vector<Vector3>& centroids,
-                                         int number_of_parts) = 0;
+                                         int number_of_parts,
+                                         const std::vector<double>& row_weights,
+                                         const std::vector<std::vector<double>>& edge_weights) = 0;
+
+  /**
+   * Collective variant of Partition for a graph whose rows are distributed over all locations.
+   * Each location passes its rows, which follow those of lower ranks in the global row numbering,
+   * and receives the partition ids of those rows. The default implementation gathers the graph
+   * on location 0 and calls Partition there.
+   *
+   * \param local_graph Adjacency list, in global row ids, of each local row.
+   * \param local_centroids Centroid of each local row.
+   * \param number_of_parts Number of partitions to create.
+   * \param local_row_weights Work estimate of each local row. Empty on all locations means unit
+   *        weights.
+   * \param local_edge_weights Communication weight of each local edge, laid out like
+   *        `local_graph`. Empty on all locations means unit weights.
+   */
+  virtual std::vector<int64_t>
+  PartitionDistributed(const std::vector<std::vector<uint64_t>>& local_graph,
+                       const std::vector<Vector3>& local_centroids,
+                       int number_of_parts,
+                       const std::vector<double>& local_row_weights,
+                       const std::vector<std::vector<double>>& local_edge_weights);
 
 protected:
   static InputParameters GetInputParameters();
@@ -77,10 +77,16 @@ KBAGraphPartitioner::KBAGraphPartitioner(const InputParameters& params)
 std::vector<int64_t>
 KBAGraphPartitioner::Partition(const std::vector<std::vector<uint64_t>>& graph,
                                const std::vector<Vector3>& centroids,
-                               int number_of_parts)
+                               int number_of_parts,
+                               const std::vector<double>& row_weights,
+                               const std::vector<std::vector<double>>&)
 {
   log.Log0Verbose1() << "Partitioning with KBAGraphPartitioner";
 
+  // The cuts are prescribed, so weights cannot move them
+  if (not row_weights.empty())
+    log.Log0Verbose1() << "KBAGraphPartitioner ignores row weights; partitions follow the cuts.";
+
   OpenSnLogicalErrorIf(centroids.size() != graph.size(),
                        "Graph number of entries not equal to centroids' number of entries.");
   const size_t num_cells = graph.size();
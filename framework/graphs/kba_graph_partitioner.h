@@ -17,7 +17,9 @@ public:
 
   std::vector<int64_t> Partition(const std::vector<std::vector<uint64_t>>& graph,
                                  const std::vector<Vector3>& centroids,
-                                 int number_of_parts) override;
+                                 int number_of_parts,
+                                 const std::vector<double>& row_weights,
+                                 const std::vector<std::vector<double>>& edge_weights) override;
 
 protected:
   const size_t nx_, ny_, nz_;
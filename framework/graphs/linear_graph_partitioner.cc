@@ -6,6 +6,7 @@
 #include "framework/utils/utils.h"
 #include "framework/logging/log.h"
 #include <cmath>
+#include <numeric>
 
 namespace opensn
 {
@@ -21,7 +22,8 @@ LinearGraphPartitioner::GetInputParameters()
     "Basic linear partitioning. This type of partitioner works basically only for testing. "
     "Orthogonal meshes can produce decent partitioning but for unstructured grids it can be pretty "
     "bad. It partitions cells based on their linear index \"global_id\" instead of actually "
-    "working with the graph.");
+    "working with the graph. When row weights are supplied, the contiguous ranges are balanced "
+    "by weight instead of by count.");
   params.SetDocGroup("Graphs");
 
   params.AddOptionalParameter("all_to_rank",
@@ -41,23 +43,53 @@ LinearGraphPartitioner::LinearGraphPartitioner(const InputParameters& params)
 std::vector<int64_t>
 LinearGraphPartitioner::Partition(const std::vector<std::vector<uint64_t>>& graph,
                                   const std::vector<Vector3>&,
-                                  const int number_of_parts)
+                                  const int number_of_parts,
+                                  const std::vector<double>& row_weights,
+                                  const std::vector<std::vector<double>>&)
 {
   log.Log0Verbose1() << "Partitioning with LinearGraphPartitioner";
 
-  const std::vector<SubSetInfo> sub_sets = MakeSubSets(graph.size(), number_of_parts);
+  OpenSnLogicalErrorIf(not row_weights.empty() and row_weights.size() != graph.size(),
+                       "Graph number of entries not equal to row weights' number of entries.");
 
   std::vector<int64_t> pids(graph.size(), 0);
 
-  if (all_to_rank_ < 0)
+  if (all_to_rank_ >= 0)
+    pids.assign(graph.size(), all_to_rank_);
+  else if (row_weights.empty())
   {
+    const std::vector<SubSetInfo> sub_sets = MakeSubSets(graph.size(), number_of_parts);
+
     size_t n = 0;
     for (int k = 0; k < number_of_parts; ++k)
       for (size_t m = 0; m < sub_sets[k].ss_size; ++m)
         pids[n++] = k;
   }
   else
-    pids.assign(graph.size(), all_to_rank_);
+  {
+    // Contiguous ranges of approximately equal weight. A row moves to the next part once the
+    // midpoint of its weight crosses the part boundary, and a part is never left empty as long
+    // as there are at least as many rows as parts.
+    const size_t num_rows = graph.size();
+    const double total_weight = std::accumulate(row_weights.begin(), row_weights.end(), 0.0);
+    const double part_weight = total_weight / number_of_parts;
+
+    int64_t part = 0;
+    double prefix_weight = 0.0;
+    for (size_t r = 0; r < num_rows; ++r)
+    {
+      if (r > 0 and part < number_of_parts - 1)
+      {
+        const double midpoint = prefix_weight + 0.5 * row_weights[r];
+        const bool boundary_crossed = midpoint >= static_cast<double>(part + 1) * part_weight;
+        const bool rows_needed = (num_rows - r) <= static_cast<size_t>(number_of_parts - 1 - part);
+        if (boundary_crossed or rows_needed)
+          ++part;
+      }
+      pids[r] = part;
+      prefix_weight += row_weights[r];
+    }
+  }
 
   log.Log0Verbose1() << "Done partitioning with LinearGraphPartitioner";
   return pids;
@@ -3,15 +3,40 @@
 
 #include "framework/graphs/petsc_graph_partitioner.h"
 #include "framework/object_factory.h"
+#include "framework/mpi/mpi_utils.h"
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
 #include "petsc.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
 
 namespace opensn
 {
 
 OpenSnRegisterObjectInNamespace(mesh, PETScGraphPartitioner);
 
+namespace
+{
+
+// Graph partitioners take integer weights. Weights are scaled so that their mean maps to
+// `weight_resolution`, which keeps relative differences while bounding the weight sums.
+constexpr double weight_resolution = 100.0;
+
+double
+WeightScale(double sum, size_t count)
+{
+  return sum > 0.0 ? weight_resolution * static_cast<double>(count) / sum : 1.0;
+}
+
+PetscInt
+ScaleWeight(double weight, double scale)
+{
+  return std::max<PetscInt>(1, static_cast<PetscInt>(std::llround(weight * scale)));
+}
+
+} // namespace
+
 InputParameters
 PETScGraphPartitioner::GetInputParameters()
 {
@@ -33,7 +58,9 @@ PETScGraphPartitioner::PETScGraphPartitioner(const InputParameters& params)
 std::vector<int64_t>
 PETScGraphPartitioner::Partition(const std::vector<std::vector<uint64_t>>& graph,
                                  const std::vector<Vector3>&,
-                                 int number_of_parts)
+                                 int number_of_parts,
+                                 const std::vector<double>& row_weights,
+                                 const std::vector<std::vector<double>>& edge_weights)
 {
   log.Log0Verbose1() << "Partitioning with PETScGraphPartitioner";
   // Determine avg num faces per cell
@@ -86,6 +113,28 @@ PETScGraphPartitioner::Partition(const std::vector<std::vector<uint64_t>>& graph
 
     log.Log0Verbose1() << "Done copying to raw indices.";
 
+    PetscInt* edge_weights_raw = nullptr;
+    if (not edge_weights.empty())
+    {
+      OpenSnLogicalErrorIf(edge_weights.size() != num_raw_cells,
+                           "Graph number of entries not equal to edge weights' number of entries.");
+      double sum = 0.0;
+      for (size_t c = 0; c < num_raw_cells; ++c)
+      {
+        OpenSnLogicalErrorIf(edge_weights[c].size() != graph[c].size(),
+                             "Edge weights do not match the graph row structure.");
+        for (const double w : edge_weights[c])
+          sum += w;
+      }
+      const double scale = WeightScale(sum, j_indices.size());
+
+      PetscMalloc(j_indices.size() * sizeof(PetscInt), &edge_weights_raw);
+      size_t k = 0;
+      for (const auto& row : edge_weights)
+        for (const double w : row)
+          edge_weights_raw[k++] = ScaleWeight(w, scale);
+    }
+
     // Create adjacency matrix
     Mat Adj; // Adjacency matrix
     MatCreateMPIAdj(PETSC_COMM_SELF,
@@ -93,7 +142,7 @@ PETScGraphPartitioner::Partition(const std::vector<std::vector<uint64_t>>& graph
                     (int64_t)num_raw_cells,
                     i_indices_raw,
                     j_indices_raw,
-                    nullptr,
+                    edge_weights_raw,
                     &Adj);
 
     log.Log0Verbose1() << "Done creating adjacency matrix.";
@@ -105,6 +154,22 @@ PETScGraphPartitioner::Partition(const std::vector<std::vector<uint64_t>>& graph
     MatPartitioningSetAdjacency(part, Adj);
     MatPartitioningSetType(part, type_.c_str());
     MatPartitioningSetNParts(part, number_of_parts);
+    if (edge_weights_raw)
+      MatPartitioningSetUseEdgeWeights(part, PETSC_TRUE);
+    if (not row_weights.empty())
+    {
+      OpenSnLogicalErrorIf(row_weights.size() != num_raw_cells,
+                           "Graph number of entries not equal to row weights' number of entries.");
+      const double sum = std::accumulate(row_weights.begin(), row_weights.end(), 0.0);
+      const double scale = WeightScale(sum, num_raw_cells);
+
+      // Ownership of the weights array passes to the partitioning object
+      PetscInt* row_weights_raw;
+      PetscMalloc(num_raw_cells * sizeof(PetscInt), &row_weights_raw);
+      for (size_t c = 0; c < num_raw_cells; ++c)
+        row_weights_raw[c] = ScaleWeight(row_weights[c], scale);
+      MatPartitioningSetVertexWeights(part, row_weights_raw);
+    }
     MatPartitioningApply(part, &is);
     MatPartitioningDestroy(&part);
     MatDestroy(&Adj);
@@ -125,4 +190,123 @@ PETScGraphPartitioner::Partition(const std::vector<std::vector<uint64_t>>& graph
   return cell_pids;
 }
 
+std::vector<int64_t>
+PETScGraphPartitioner::PartitionDistributed(
+  const std::vector<std::vector<uint64_t>>& local_graph,
+  const std::vector<Vector3>& local_centroids,
+  int number_of_parts,
+  const std::vector<double>& local_row_weights,
+  const std::vector<std::vector<double>>& local_edge_weights)
+{
+  const size_t num_local_rows = local_graph.size();
+  size_t min_num_local_rows = 0;
+  mpi_comm.all_reduce(num_local_rows, min_num_local_rows, mpi::op::min<size_t>());
+  if (mpi_comm.size() == 1 or min_num_local_rows == 0)
+    return GraphPartitioner::PartitionDistributed(
+      local_graph, local_centroids, number_of_parts, local_row_weights, local_edge_weights);
+
+  log.Log0Verbose1() << "Partitioning in parallel with PETScGraphPartitioner";
+  const auto extents = BuildLocationExtents(num_local_rows, mpi_comm);
+
+  // Build indices, owned by the adjacency matrix once it is created
+  size_t num_local_edges = 0;
+  for (const auto& row : local_graph)
+    num_local_edges += row.size();
+
+  PetscInt* i_indices_raw;
+  PetscInt* j_indices_raw;
+  PetscMalloc((num_local_rows + 1) * sizeof(PetscInt), &i_indices_raw);
+  PetscMalloc(num_local_edges * sizeof(PetscInt), &j_indices_raw);
+  {
+    size_t k = 0;
+    for (size_t r = 0; r < num_local_rows; ++r)
+    {
+      i_indices_raw[r] = static_cast<PetscInt>(k);
+      for (const uint64_t neighbor_id : local_graph[r])
+        j_indices_raw[k++] = static_cast<PetscInt>(neighbor_id);
+    }
+    i_indices_raw[num_local_rows] = static_cast<PetscInt>(k);
+  }
+
+  // Weights are scaled with their global mean so that all locations use the same scale
+  PetscInt* edge_weights_raw = nullptr;
+  int has_edge_weights = local_edge_weights.empty() ? 0 : 1;
+  mpi_comm.all_reduce(has_edge_weights, mpi::op::max<int>());
+  if (has_edge_weights)
+  {
+    OpenSnLogicalErrorIf(local_edge_weights.size() != num_local_rows,
+                         "Graph number of entries not equal to edge weights' number of entries.");
+    double local_sum = 0.0;
+    for (size_t r = 0; r < num_local_rows; ++r)
+    {
+      OpenSnLogicalErrorIf(local_edge_weights[r].size() != local_graph[r].size(),
+                           "Edge weights do not match the graph row structure.");
+      local_sum += std::accumulate(local_edge_weights[r].begin(), local_edge_weights[r].end(), 0.0);
+    }
+    double sum = 0.0;
+    mpi_comm.all_reduce(local_sum, sum, mpi::op::sum<double>());
+    size_t num_edges = 0;
+    mpi_comm.all_reduce(num_local_edges, num_edges, mpi::op::sum<size_t>());
+    const double scale = WeightScale(sum, num_edges);
+
+    PetscMalloc(num_local_edges * sizeof(PetscInt), &edge_weights_raw);
+    size_t k = 0;
+    for (const auto& row : local_edge_weights)
+      for (const double w : row)
+        edge_weights_raw[k++] = ScaleWeight(w, scale);
+  }
+
+  Mat Adj;
+  MatCreateMPIAdj(PETSC_COMM_WORLD,
+                  static_cast<PetscInt>(num_local_rows),
+                  static_cast<PetscInt>(extents.back()),
+                  i_indices_raw,
+                  j_indices_raw,
+                  edge_weights_raw,
+                  &Adj);
+
+  MatPartitioning part;
+  IS is;
+  MatPartitioningCreate(PETSC_COMM_WORLD, &part);
+  MatPartitioningSetAdjacency(part, Adj);
+  MatPartitioningSetType(part, type_.c_str());
+  MatPartitioningSetNParts(part, number_of_parts);
+  if (edge_weights_raw)
+    MatPartitioningSetUseEdgeWeights(part, PETSC_TRUE);
+
+  int has_row_weights = local_row_weights.empty() ? 0 : 1;
+  mpi_comm.all_reduce(has_row_weights, mpi::op::max<int>());
+  if (has_row_weights)
+  {
+    OpenSnLogicalErrorIf(local_row_weights.size() != num_local_rows,
+                         "Graph number of entries not equal to row weights' number of entries.");
+    const double local_sum =
+      std::accumulate(local_row_weights.begin(), local_row_weights.end(), 0.0);
+    double sum = 0.0;
+    mpi_comm.all_reduce(local_sum, sum, mpi::op::sum<double>());
+    const double scale = WeightScale(sum, extents.back());
+
+    // Ownership of the weights array passes to the partitioning object
+    PetscInt* row_weights_raw;
+    PetscMalloc(num_local_rows * sizeof(PetscInt), &row_weights_raw);
+    for (size_t r = 0; r < num_local_rows; ++r)
+      row_weights_raw[r] = ScaleWeight(local_row_weights[r], scale);
+    MatPartitioningSetVertexWeights(part, row_weights_raw);
+  }
+  MatPartitioningApply(part, &is);
+  MatPartitioningDestroy(&part);
+  MatDestroy(&Adj);
+
+  std::vector<int64_t> row_pids(num_local_rows, 0);
+  const PetscInt* row_pids_raw;
+  ISGetIndices(is, &row_pids_raw);
+  for (size_t r = 0; r < num_local_rows; ++r)
+    row_pids[r] = row_pids_raw[r];
+  ISRestoreIndices(is, &row_pids_raw);
+  ISDestroy(&is);
+
+  log.Log0Verbose1() << "Done partitioning in parallel with PETScGraphPartitioner";
+  return row_pids;
+}
+
 } // namespace opensn
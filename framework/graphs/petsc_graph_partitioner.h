@@ -16,7 +16,20 @@ public:
 
   std::vector<int64_t> Partition(const std::vector<std::vector<uint64_t>>& graph,
                                  const std::vector<Vector3>& centroids,
-                                 int number_of_parts) override;
+                                 int number_of_parts,
+                                 const std::vector<double>& row_weights,
+                                 const std::vector<std::vector<double>>& edge_weights) override;
+
+  /**
+   * Partitions the distributed graph with a parallel PETSc partitioning over all locations.
+   * Falls back to the gathering default when running serially or when a location has no rows.
+   */
+  std::vector<int64_t>
+  PartitionDistributed(const std::vector<std::vector<uint64_t>>& local_graph,
+                       const std::vector<Vector3>& local_centroids,
+                       int number_of_parts,
+                       const std::vector<double>& local_row_weights,
+                       const std::vector<std::vector<double>>& local_edge_weights) override;
 
 protected:
   const std::string type_;
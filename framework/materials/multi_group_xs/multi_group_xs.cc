@@ -227,6 +227,7 @@ MultiGroupXS::Reset()
   nu_delayed_sigma_f_.clear();
   production_matrix_.clear();
   precursors_.clear();
+  groupset_transfers_.clear();
 
   inv_velocity_.clear();
 
@@ -388,12 +389,66 @@ MultiGroupXS::SetScalingFactor(const double factor)
     for (size_t g = 0; g < num_groups_; ++g)
       for (const auto& [_, gp, sig_ell] : S_ell.Row(g))
         sig_ell *= m;
+  groupset_transfers_.clear();
 
   // Reinitialize diffusion
   diffusion_initialized_ = false;
   ComputeDiffusionParameters();
 }
 
+const MultiGroupXS::GroupsetTransfer&
+MultiGroupXS::GetGroupsetTransfer(size_t first_group, size_t last_group) const
+{
+  const auto key = std::make_pair(first_group, last_group);
+  const auto it = groupset_transfers_.find(key);
+  if (it != groupset_transfers_.end())
+    return it->second;
+
+  OpenSnInvalidArgumentIf(first_group > last_group or last_group >= num_groups_,
+                          "Invalid groupset range " + std::to_string(first_group) + " to " +
+                            std::to_string(last_group) + ".");
+
+  const auto& S = TransferMatrices();
+  const size_t num_gs_groups = last_group - first_group + 1;
+
+  GroupsetTransfer transfer;
+  transfer.self.assign(S.size(), std::vector<double>(num_gs_groups, 0.0));
+  transfer.within_groupset.resize(S.size());
+  transfer.across_groupset.resize(S.size());
+  for (size_t ell = 0; ell < S.size(); ++ell)
+  {
+    auto& within = transfer.within_groupset[ell];
+    auto& across = transfer.across_groupset[ell];
+    within.row_offsets.assign(1, 0);
+    across.row_offsets.assign(1, 0);
+    for (size_t g = first_group; g <= last_group; ++g)
+    {
+      const auto& cols = S[ell].rowI_indices[g];
+      const auto& vals = S[ell].rowI_values[g];
+      for (size_t j = 0; j < cols.size(); ++j)
+      {
+        const size_t gp = cols[j];
+        if (gp == g)
+          transfer.self[ell][g - first_group] += vals[j];
+        else if (gp >= first_group and gp <= last_group)
+        {
+          within.columns.push_back(gp);
+          within.values.push_back(vals[j]);
+        }
+        else
+        {
+          across.columns.push_back(gp);
+          across.values.push_back(vals[j]);
+        }
+      }
+      within.row_offsets.push_back(within.columns.size());
+      across.row_offsets.push_back(across.columns.size());
+    }
+  }
+
+  return groupset_transfers_.emplace(key, std::move(transfer)).first->second;
+}
+
 void
 MultiGroupXS::TransposeTransferAndProduction()
 {
@@ -5,6 +5,8 @@
 
 #include "framework/materials/material_property.h"
 #include "framework/math/sparse_matrix/sparse_matrix.h"
+#include <map>
+#include <utility>
 
 namespace opensn
 {
@@ -73,6 +75,8 @@ public:
 
   void SetAdjointMode(bool val)
   {
+    if (val != adjoint_)
+      groupset_transfers_.clear();
     adjoint_ = val;
     if (adjoint_ and transposed_transfer_matrices_.empty())
       TransposeTransferAndProduction();
@@ -96,6 +100,37 @@ public:
     return adjoint_ ? transposed_transfer_matrices_.at(ell) : transfer_matrices_.at(ell);
   }
 
+  /// Transfer matrix rows of a groupset in compressed row storage with contiguous arrays.
+  struct TransferBlock
+  {
+    /// Offsets of the entries of each groupset group in `columns` and `values`.
+    std::vector<size_t> row_offsets;
+    /// Source group of each entry.
+    std::vector<size_t> columns;
+    std::vector<double> values;
+  };
+
+  /**
+   * Transfer matrices restricted to the rows of a groupset, per scattering moment, and split by
+   * source group into within-group, within-groupset and across-groupset parts.
+   */
+  struct GroupsetTransfer
+  {
+    /// Within-group transfer of each groupset group.
+    std::vector<std::vector<double>> self;
+    /// Transfer from the other groups of the groupset.
+    std::vector<TransferBlock> within_groupset;
+    /// Transfer from the groups outside of the groupset.
+    std::vector<TransferBlock> across_groupset;
+  };
+
+  /**
+   * Returns the transfer matrices of the current (forward or adjoint) mode restricted to the
+   * groupset spanning groups `first_group` through `last_group`. The blocks are built on first
+   * use and kept until the cross sections change.
+   */
+  const GroupsetTransfer& GetGroupsetTransfer(size_t first_group, size_t last_group) const;
+
   const std::vector<double>& Chi() const { return chi_; }
 
   const std::vector<double>& SigmaFission() const { return sigma_f_; }
@@ -165,6 +200,8 @@ private:
   /// Total neutron production matrix
   std::vector<std::vector<double>> production_matrix_;
   std::vector<std::vector<double>> transposed_production_matrix_;
+  /// Groupset transfer blocks, keyed by the first and last group of the groupset
+  mutable std::map<std::pair<size_t, size_t>, GroupsetTransfer> groupset_transfers_;
 
   // Diffusion quantities
   bool diffusion_initialized_;
@@ -424,6 +424,88 @@ GaussElimination(DenseMatrix<TYPE>& A, Vector<TYPE>& b, unsigned int n)
   }
 }
 
+/**
+ * Gauss Elimination without pivoting for a batch of systems of the same size. The systems are
+ * stored batch-innermost, i.e. `A[(i * n + j) * batch_size + l]` and `b[i * batch_size + l]`,
+ * so that every inner loop runs over contiguous batch lanes and vectorizes. When `N` is nonzero
+ * the system size is a compile-time constant and the node loops are fully unrolled. On exit `b`
+ * holds the solutions and the pivots of `A` are replaced by their reciprocals.
+ */
+template <unsigned int N = 0>
+void
+BatchedGaussElimination(double* A, double* b, unsigned int n, size_t batch_size)
+{
+  const unsigned int num_rows = (N > 0) ? N : n;
+  const size_t row_stride = num_rows * batch_size;
+
+  // Forward elimination
+  for (unsigned int i = 0; i < num_rows; ++i)
+  {
+    double* inv_pivot = A + i * row_stride + i * batch_size;
+    for (size_t l = 0; l < batch_size; ++l)
+      inv_pivot[l] = 1.0 / inv_pivot[l];
+
+    const double* bi = b + i * batch_size;
+    for (unsigned int j = i + 1; j < num_rows; ++j)
+    {
+      double* Aji = A + j * row_stride + i * batch_size;
+      double* bj = b + j * batch_size;
+      for (size_t l = 0; l < batch_size; ++l)
+      {
+        Aji[l] *= inv_pivot[l];
+        bj[l] -= Aji[l] * bi[l];
+      }
+      for (unsigned int k = i + 1; k < num_rows; ++k)
+      {
+        double* Ajk = A + j * row_stride + k * batch_size;
+        const double* Aik = A + i * row_stride + k * batch_size;
+        for (size_t l = 0; l < batch_size; ++l)
+          Ajk[l] -= Aji[l] * Aik[l];
+      }
+    }
+  }
+
+  // Back substitution
+  for (int i = static_cast<int>(num_rows) - 1; i >= 0; --i)
+  {
+    double* bi = b + i * batch_size;
+    for (unsigned int j = i + 1; j < num_rows; ++j)
+    {
+      const double* Aij = A + i * row_stride + j * batch_size;
+      const double* bj = b + j * batch_size;
+      for (size_t l = 0; l < batch_size; ++l)
+        bi[l] -= Aij[l] * bj[l];
+    }
+    const double* inv_pivot = A + i * row_stride + i * batch_size;
+    for (size_t l = 0; l < batch_size; ++l)
+      bi[l] *= inv_pivot[l];
+  }
+}
+
+/**
+ * Dispatches BatchedGaussElimination to a compile-time unrolled variant for the common system
+ * sizes (2, 4 and 8, i.e. PWLD slabs, quadrilaterals and hexahedra) and to the generic variant
+ * otherwise.
+ */
+inline void
+BatchedGaussEliminationDispatch(double* A, double* b, unsigned int n, size_t batch_size)
+{
+  switch (n)
+  {
+    case 2:
+      BatchedGaussElimination<2>(A, b, n, batch_size);
+      break;
+    case 4:
+      BatchedGaussElimination<4>(A, b, n, batch_size);
+      break;
+    case 8:
+      BatchedGaussElimination<8>(A, b, n, batch_size);
+      break;
+    default:
+      BatchedGaussElimination<0>(A, b, n, batch_size);
+  }
+}
+
 /// Computes the inverse of a matrix using Gauss-Elimination with pivoting.
 template <typename TYPE>
 DenseMatrix<TYPE>
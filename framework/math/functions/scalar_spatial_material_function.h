@@ -24,6 +24,22 @@ public:
    * \return Function value
    */
   virtual double Evaluate(int mat_id, const Vector3& xyz) const = 0;
+
+  /**
+   * Evaluate this function at a batch of points of a single material
+   *
+   * \param mat_id The material ID of the cell
+   * \param xyz The xyz coordinates of the points where the function is called.
+   * \return Function values, one per point
+   */
+  virtual std::vector<double> EvaluateBatch(int mat_id, const std::vector<Vector3>& xyz) const
+  {
+    std::vector<double> values;
+    values.reserve(xyz.size());
+    for (const auto& point : xyz)
+      values.push_back(Evaluate(mat_id, point));
+    return values;
+  }
 };
 
 } // namespace opensn
@@ -83,6 +83,15 @@ public:
    */
   void CommunicateGhostEntries() override { ghost_comm_.CommunicateGhostEntries(values_); }
 
+  /**
+   * Start communicating the ghost entries. The locally owned entries may be read and modified
+   * before the communication is completed with EndGhostCommunication.
+   */
+  void BeginGhostCommunication() { ghost_comm_.BeginGhostCommunication(values_); }
+
+  /// Complete the ghost communication started with BeginGhostCommunication.
+  void EndGhostCommunication() { ghost_comm_.EndGhostCommunication(values_); }
+
 private:
   VectorGhostCommunicator ghost_comm_;
 };
@@ -45,45 +45,41 @@ VectorGhostCommunicator::MakeCachedParallelData()
     for (const int64_t gid : gids)
       ghost_to_recv_map[gid] = count++;
 
-  std::vector<int> sendcounts;
-  std::vector<int> senddispls;
-  std::vector<int> recvcounts;
-  std::vector<int> recvdispls;
+  std::vector<size_t> ghost_recv_positions;
+  ghost_recv_positions.reserve(ghost_ids_.size());
+  for (const int64_t ghost_id : ghost_ids_)
+    ghost_recv_positions.push_back(ghost_to_recv_map.at(ghost_id));
 
   // Now, the structure of the data being received from communication
-  // is developed. This involves determining the amount of data
-  // being sent per process and the starting position of the data in
-  // the receive buffer per process.
-  int total_recvcounts = 0;
-  recvcounts.assign(process_count_, 0);
-  recvdispls.assign(process_count_, 0);
+  // is developed. Only the processes that own ghosts are recorded,
+  // along with the starting position of their data in the receive
+  // buffer.
+  std::vector<int> recv_pids;
+  std::vector<size_t> recv_offsets = {0};
   for (const auto& [pid, gids] : recv_map)
   {
-    recvcounts[pid] = static_cast<int>(gids.size());
-    recvdispls[pid] = total_recvcounts;
-    total_recvcounts += static_cast<int>(gids.size());
+    recv_pids.push_back(pid);
+    recv_offsets.push_back(recv_offsets.back() + gids.size());
   }
 
   // For communication, each process must also know what it is
-  // sending to other processors. If each processor sends each
+  // sending to other processes. If each process sends each
   // other process the global ids it needs to receive, then each
   // process will know what other processes need from it. The
   // MPI utility MapAllToAll in OpenSn accomplishes this task,
   // returning a mapping of processes to the global ids that this
-  // process needs to send.
+  // process needs to send. This is the only step of the setup that
+  // involves every process.
   std::map<int, std::vector<int64_t>> send_map = MapAllToAll(recv_map, comm_);
 
-  // With this information, the amount of information that needs
-  // to be sent can be determined.
-  size_t send_size = 0;
-  for (const auto& [pid, gids] : send_map)
-    send_size += gids.size();
-
   // Next, the local ids on this process that need to be
-  // communicated to other processes can be determined and stored.
+  // communicated to other processes can be determined and stored,
+  // along with the processes they are sent to.
+  std::vector<int> send_pids;
+  std::vector<size_t> send_offsets = {0};
   std::vector<int64_t> local_ids_to_send;
-  local_ids_to_send.reserve(send_size);
   for (const auto& [pid, gids] : send_map)
+  {
     for (const int64_t gid : gids)
     {
       OpenSnLogicalErrorIf(gid < extents_[location_id_] or gid >= extents_[location_id_ + 1],
@@ -95,30 +91,21 @@ VectorGhostCommunicator::MakeCachedParallelData()
 
       local_ids_to_send.push_back(gid - static_cast<int64_t>(extents_[location_id_]));
     }
-
-  // Finally, the communication pattern for the data being sent
-  // can be constructed similarly to that for the received data.
-  int total_sendcounts = 0;
-  sendcounts.assign(process_count_, 0);
-  senddispls.assign(process_count_, 0);
-  for (const auto& [pid, gids] : send_map)
-  {
-    sendcounts[pid] = static_cast<int>(gids.size());
-    senddispls[pid] = total_sendcounts;
-    total_sendcounts += static_cast<int>(gids.size());
+    send_pids.push_back(pid);
+    send_offsets.push_back(local_ids_to_send.size());
   }
 
-  return CachedParallelData{std::move(sendcounts),
-                            std::move(senddispls),
-                            std::move(recvcounts),
-                            std::move(recvdispls),
+  return CachedParallelData{std::move(send_pids),
+                            std::move(send_offsets),
+                            std::move(recv_pids),
+                            std::move(recv_offsets),
                             std::move(local_ids_to_send),
-                            std::move(ghost_to_recv_map)};
+                            std::move(ghost_recv_positions)};
 }
 
 VectorGhostCommunicator::VectorGhostCommunicator(const VectorGhostCommunicator& other)
   : local_size_(other.local_size_),
-    global_size_(other.local_size_),
+    global_size_(other.global_size_),
     ghost_ids_(other.ghost_ids_),
     comm_(other.comm_),
     location_id_(other.location_id_),
@@ -130,7 +117,7 @@ VectorGhostCommunicator::VectorGhostCommunicator(const VectorGhostCommunicator&
 
 VectorGhostCommunicator::VectorGhostCommunicator(VectorGhostCommunicator&& other) noexcept
   : local_size_(other.local_size_),
-    global_size_(other.local_size_),
+    global_size_(other.global_size_),
     ghost_ids_(other.ghost_ids_),
     comm_(other.comm_),
     location_id_(other.location_id_),
@@ -143,11 +130,10 @@ VectorGhostCommunicator::VectorGhostCommunicator(VectorGhostCommunicator&& other
 int64_t
 VectorGhostCommunicator::MapGhostToLocal(const int64_t ghost_id) const
 {
-  OpenSnInvalidArgumentIf(cached_parallel_data_.ghost_to_recv_map.count(ghost_id) == 0,
-                          "The given ghost id does not belong to this communicator.");
-
   // Get the position within the ghost id vector of the given ghost id
   const auto k = std::find(ghost_ids_.begin(), ghost_ids_.end(), ghost_id) - ghost_ids_.begin();
+  OpenSnInvalidArgumentIf(k == static_cast<int64_t>(ghost_ids_.size()),
+                          "The given ghost id does not belong to this communicator.");
 
   // Local index is local size plus the position in the ghost id vector
   return static_cast<int64_t>(local_size_) + k;
@@ -155,6 +141,13 @@ VectorGhostCommunicator::MapGhostToLocal(const int64_t ghost_id) const
 
 void
 VectorGhostCommunicator::CommunicateGhostEntries(std::vector<double>& ghosted_vector) const
+{
+  BeginGhostCommunication(ghosted_vector);
+  EndGhostCommunication(ghosted_vector);
+}
+
+void
+VectorGhostCommunicator::BeginGhostCommunication(const std::vector<double>& ghosted_vector) const
 {
   OpenSnInvalidArgumentIf(ghosted_vector.size() != local_size_ + ghost_ids_.size(),
                           std::string(__FUNCTION__) +
@@ -162,33 +155,59 @@ VectorGhostCommunicator::CommunicateGhostEntries(std::vector<double>& ghosted_ve
                             "input size = " +
                             std::to_string(ghosted_vector.size()) + " requirement " +
                             std::to_string(local_size_ + ghost_ids_.size()));
+  OpenSnLogicalErrorIf(ghost_exchange_.in_progress,
+                       std::string(__FUNCTION__) + ": A ghost update is already in progress.");
+
+  constexpr int tag = 0;
+  const auto& data = cached_parallel_data_;
+  auto& exchange = ghost_exchange_;
+
+  // Post the receives first so that incoming messages land directly in the receive buffer
+  exchange.recv_buffer.resize(ghost_ids_.size());
+  exchange.requests.clear();
+  for (size_t i = 0; i < data.recv_pids.size(); ++i)
+  {
+    const auto offset = data.recv_offsets[i];
+    const auto count = static_cast<int>(data.recv_offsets[i + 1] - offset);
+    exchange.requests.push_back(
+      comm_.irecv(data.recv_pids[i], tag, exchange.recv_buffer.data() + offset, count));
+  }
 
   // Serialize the data that needs to be sent
-  const size_t send_size = cached_parallel_data_.local_ids_to_send.size();
-  std::vector<double> send_data;
-  send_data.reserve(send_size);
-  for (const int64_t local_id : cached_parallel_data_.local_ids_to_send)
-    send_data.push_back(ghosted_vector[local_id]);
-
-  // Create serialized storage for the data to be received
-  const size_t recv_size = ghost_ids_.size();
-  std::vector<double> recv_data(recv_size, 0.0);
-
-  // Communicate the ghost data
-  comm_.all_to_all(send_data,
-                   cached_parallel_data_.sendcounts,
-                   cached_parallel_data_.senddispls,
-                   recv_data,
-                   cached_parallel_data_.recvcounts,
-                   cached_parallel_data_.recvdispls);
+  exchange.send_buffer.resize(data.local_ids_to_send.size());
+  for (size_t k = 0; k < data.local_ids_to_send.size(); ++k)
+    exchange.send_buffer[k] = ghosted_vector[data.local_ids_to_send[k]];
+
+  for (size_t i = 0; i < data.send_pids.size(); ++i)
+  {
+    const auto offset = data.send_offsets[i];
+    const auto count = static_cast<int>(data.send_offsets[i + 1] - offset);
+    exchange.requests.push_back(
+      comm_.isend(data.send_pids[i], tag, exchange.send_buffer.data() + offset, count));
+  }
+
+  exchange.in_progress = true;
+}
+
+void
+VectorGhostCommunicator::EndGhostCommunication(std::vector<double>& ghosted_vector) const
+{
+  OpenSnLogicalErrorIf(not ghost_exchange_.in_progress,
+                       std::string(__FUNCTION__) + ": No ghost update is in progress.");
+  OpenSnInvalidArgumentIf(ghosted_vector.size() != local_size_ + ghost_ids_.size(),
+                          std::string(__FUNCTION__) + ": Vector size mismatch.");
+
+  auto& exchange = ghost_exchange_;
+  mpi::wait_all(exchange.requests);
+  exchange.in_progress = false;
 
   // Lastly, populate the local vector with ghost data. All ghost data is
   // appended to the back of the local vector. Using the mapping between
   // ghost indices and the relative ghost index position along with the
   // ordering of the ghost indices, this can be accomplished.
-  for (size_t k = 0; k < recv_size; ++k)
-    ghosted_vector[local_size_ + k] =
-      recv_data[cached_parallel_data_.ghost_to_recv_map.at(ghost_ids_[k])];
+  const auto& ghost_recv_positions = cached_parallel_data_.ghost_recv_positions;
+  for (size_t k = 0; k < ghost_ids_.size(); ++k)
+    ghosted_vector[local_size_ + k] = exchange.recv_buffer[ghost_recv_positions[k]];
 }
 
 std::vector<double>
@@ -221,10 +240,11 @@ VectorGhostCommunicator::FindOwnerPID(const int64_t global_id) const
                             std::to_string(global_id) + " vs [0," + std::to_string(global_size_) +
                             ")");
 
-  for (int p = 0; p < process_count_; ++p)
-    if (global_id >= extents_[p] and global_id < extents_[p + 1])
-      return p;
-  return -1;
+  // The extents are sorted, so the owner is the last location whose first index is not greater
+  // than the global id
+  const auto it =
+    std::upper_bound(extents_.begin(), extents_.end(), static_cast<uint64_t>(global_id));
+  return static_cast<int>(it - extents_.begin()) - 1;
 }
 
 } // namespace opensn
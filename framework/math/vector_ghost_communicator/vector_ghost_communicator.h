@@ -6,7 +6,6 @@
 #include "mpicpp-lite/mpicpp-lite.h"
 #include <vector>
 #include <cstdint>
-#include <map>
 
 namespace mpi = mpicpp_lite;
 
@@ -39,8 +38,21 @@ public:
 
   int64_t MapGhostToLocal(int64_t ghost_id) const;
 
+  /// Updates the ghost entries of the vector with the values owned by other locations.
   void CommunicateGhostEntries(std::vector<double>& ghosted_vector) const;
 
+  /**
+   * Starts a ghost update. The locally owned entries of the vector are packed and sent, and the
+   * ghost values are received into an internal buffer, so the vector may be read and modified
+   * until EndGhostCommunication is called. Only one update per communicator may be in flight, and
+   * overlapping updates on communicators sharing an MPI communicator must be started in the same
+   * order on all locations.
+   */
+  void BeginGhostCommunication(const std::vector<double>& ghosted_vector) const;
+
+  /// Completes a ghost update started by BeginGhostCommunication and writes the ghost entries.
+  void EndGhostCommunication(std::vector<double>& ghosted_vector) const;
+
   std::vector<double> MakeGhostedVector() const;
   std::vector<double> MakeGhostedVector(const std::vector<double>& local_vector) const;
 
@@ -54,20 +66,40 @@ protected:
   const int process_count_;
   const std::vector<uint64_t> extents_;
 
+  /**
+   * Neighborhood communication pattern. Only the locations this location exchanges data with are
+   * stored, so ghost updates cost O(number of neighbors) rather than O(number of locations).
+   */
   struct CachedParallelData
   {
-    std::vector<int> sendcounts;
-    std::vector<int> senddispls;
-    std::vector<int> recvcounts;
-    std::vector<int> recvdispls;
+    /// Locations this location sends owned entries to.
+    std::vector<int> send_pids;
+    /// Offsets of the entries sent to each location in `local_ids_to_send`.
+    std::vector<size_t> send_offsets;
+    /// Locations this location receives ghost entries from.
+    std::vector<int> recv_pids;
+    /// Offsets of the entries received from each location in the receive buffer.
+    std::vector<size_t> recv_offsets;
 
     std::vector<int64_t> local_ids_to_send;
-    std::map<int64_t, size_t> ghost_to_recv_map;
+    /// Position in the receive buffer of each ghost, in ghost id order.
+    std::vector<size_t> ghost_recv_positions;
   };
 
   const CachedParallelData cached_parallel_data_;
 
 private:
+  /// Buffers and requests of a ghost update in flight.
+  struct GhostExchange
+  {
+    std::vector<double> send_buffer;
+    std::vector<double> recv_buffer;
+    std::vector<mpi::Request> requests;
+    bool in_progress = false;
+  };
+
+  mutable GhostExchange ghost_exchange_;
+
   int FindOwnerPID(int64_t global_id) const;
   CachedParallelData MakeCachedParallelData();
 };
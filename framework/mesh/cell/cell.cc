@@ -443,6 +443,9 @@ Cell::RecomputeCentroidsAndNormals(const MeshContinuum& grid)
       face.normal = weighted_normal.Normalized();
     }
   }
+
+  // The cell's bounding box may have changed
+  grid.InvalidateCellSearchTree();
 }
 
 } // namespace opensn
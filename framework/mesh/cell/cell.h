@@ -131,7 +131,7 @@ public:
 
   /**
    * Recomputes the cell centroid and all face centroids assuming the mesh vertices have been
-   * transformed.
+   * transformed. Invalidates the point search tree of the grid.
    */
   void RecomputeCentroidsAndNormals(const MeshContinuum& grid);
 };
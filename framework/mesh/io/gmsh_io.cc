@@ -44,4 +44,34 @@ MeshIO::FromGmsh(const UnpartitionedMesh::Options& options)
   return nullptr;
 }
 
+MeshIO::MeshFileSlice
+MeshIO::FromGmshSlice(const UnpartitionedMesh::Options& options)
+{
+  const std::string fname = "MeshIO::FromGmshSlice";
+
+  // Open file
+  std::ifstream file(options.file_name);
+  if (not file.is_open())
+    throw std::runtime_error(fname + ": Failed to open file " + options.file_name);
+
+  // Check file format version
+  std::string file_line;
+  while (std::getline(file, file_line))
+    if ("$MeshFormat" == file_line)
+      break;
+
+  std::getline(file, file_line);
+  std::istringstream iss(file_line);
+
+  file.close();
+
+  double format;
+  if (not(iss >> format))
+    throw std::logic_error(fname + ": Failed to read Gmsh file format.");
+  else if (format == 2.2)
+    return FromGmshV22Slice(options);
+  else
+    throw std::logic_error(fname + ": Only Gmsh format 2.2 supports distributed reading.");
+}
+
 } // namespace opensn
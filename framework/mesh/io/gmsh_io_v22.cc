@@ -4,11 +4,321 @@
 #include "framework/mesh/io/mesh_io.h"
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
+#include <algorithm>
+#include <filesystem>
 #include <fstream>
+#include <limits>
+#include <tuple>
 
 namespace opensn
 {
 
+namespace
+{
+
+bool
+IsElementType1D(int type)
+{
+  return type == 1;
+}
+
+bool
+IsElementType2D(int type)
+{
+  return type == 2 || type == 3;
+}
+
+bool
+IsElementType3D(int type)
+{
+  return type >= 4 && type <= 7;
+}
+
+bool
+IsElementSupported(int type)
+{
+  return type >= 1 && type <= 7;
+}
+
+CellType
+CellTypeFromMSHTypeID(int type)
+{
+  switch (type)
+  {
+    case 1:
+      return CellType::SLAB;
+    case 2:
+      return CellType::TRIANGLE;
+    case 3:
+      return CellType::QUADRILATERAL;
+    case 4:
+      return CellType::TETRAHEDRON;
+    case 5:
+      return CellType::HEXAHEDRON;
+    case 6:
+    case 7:
+      return CellType::POLYHEDRON;
+    default:
+      return CellType::GHOST;
+  }
+}
+
+/// A line of the $Elements section.
+struct GmshElement
+{
+  int type = 0;
+  int physical_region = 0;
+  /// Zero-based node indices.
+  std::vector<uint64_t> nodes;
+};
+
+GmshElement
+ReadElement(const std::string& file_line, const std::string& fname)
+{
+  std::istringstream iss(file_line);
+
+  GmshElement element;
+  int element_index, num_tags;
+  if (not(iss >> element_index >> element.type >> num_tags))
+    throw std::logic_error(fname + ": Failed reading element index, type, and number of tags.");
+
+  if (not(iss >> element.physical_region))
+    throw std::logic_error(fname + ": Failed reading physical region.");
+
+  int tag;
+  for (int i = 1; i < num_tags; i++)
+    if (not(iss >> tag))
+      throw std::logic_error(fname + ": Failed reading tags.");
+
+  int num_cell_nodes = 0;
+  if (element.type == 1) // 2-node edge
+    num_cell_nodes = 2;
+  else if (element.type == 2) // 3-node triangle
+    num_cell_nodes = 3;
+  else if (element.type == 3 or element.type == 4) // 4-node quadrangle or tet
+    num_cell_nodes = 4;
+  else if (element.type == 5) // 8-node hexahedron
+    num_cell_nodes = 8;
+
+  element.nodes.assign(num_cell_nodes, 0);
+  for (int i = 0; i < num_cell_nodes; ++i)
+  {
+    int raw_node;
+    if (not(iss >> raw_node))
+      throw std::logic_error(fname + ": Failed reading element node index.");
+    if ((raw_node - 1) >= 0)
+      element.nodes[i] = raw_node - 1;
+  }
+
+  return element;
+}
+
+/**
+ * Makes the light-weight cell, faces included, of an element. The cell is a volume cell unless
+ * `is_boundary` is set on return. Returns nullptr for elements of neither kind.
+ */
+std::shared_ptr<UnpartitionedMesh::LightWeightCell>
+MakeCell(const GmshElement& element, bool mesh_is_2D, bool& is_boundary, const std::string& fname)
+{
+  const int element_type = element.type;
+
+  std::shared_ptr<UnpartitionedMesh::LightWeightCell> raw_cell;
+  if (mesh_is_2D)
+  {
+    if (IsElementType1D(element_type))
+    {
+      raw_cell =
+        std::make_shared<UnpartitionedMesh::LightWeightCell>(CellType::SLAB, CellType::SLAB);
+      is_boundary = true;
+    }
+    else if (IsElementType2D(element_type))
+    {
+      raw_cell = std::make_shared<UnpartitionedMesh::LightWeightCell>(
+        CellType::POLYGON, CellTypeFromMSHTypeID(element_type));
+      is_boundary = false;
+    }
+  }
+  else
+  {
+    if (IsElementType2D(element_type))
+    {
+      raw_cell = std::make_shared<UnpartitionedMesh::LightWeightCell>(
+        CellType::POLYGON, CellTypeFromMSHTypeID(element_type));
+      is_boundary = true;
+    }
+    else if (IsElementType3D(element_type))
+    {
+      raw_cell = std::make_shared<UnpartitionedMesh::LightWeightCell>(
+        CellType::POLYHEDRON, CellTypeFromMSHTypeID(element_type));
+      is_boundary = false;
+    }
+  }
+
+  if (raw_cell == nullptr)
+    return nullptr;
+
+  auto& cell = *raw_cell;
+  cell.material_id = element.physical_region;
+  cell.vertex_ids = element.nodes;
+
+  // Populate faces
+  if (element_type == 1) // 2-node edge
+  {
+    UnpartitionedMesh::LightWeightFace face0;
+    UnpartitionedMesh::LightWeightFace face1;
+
+    face0.vertex_ids = {cell.vertex_ids.at(0)};
+    face1.vertex_ids = {cell.vertex_ids.at(1)};
+
+    cell.faces.push_back(face0);
+    cell.faces.push_back(face1);
+  }
+  else if (element_type == 2 or element_type == 3) // 3-node triangle or 4-node quadrangle
+  {
+    size_t num_verts = cell.vertex_ids.size();
+    for (size_t e = 0; e < num_verts; e++)
+    {
+      size_t ep1 = (e < (num_verts - 1)) ? e + 1 : 0;
+      UnpartitionedMesh::LightWeightFace face;
+
+      face.vertex_ids = {cell.vertex_ids[e], cell.vertex_ids[ep1]};
+
+      cell.faces.push_back(std::move(face));
+    }
+  }
+  else if (element_type == 4) // 4-node tetrahedron
+  {
+    auto& v = cell.vertex_ids;
+    std::vector<UnpartitionedMesh::LightWeightFace> lw_faces(4);
+    lw_faces[0].vertex_ids = {v[0], v[2], v[1]}; // base-face
+    lw_faces[1].vertex_ids = {v[0], v[3], v[2]};
+    lw_faces[2].vertex_ids = {v[3], v[1], v[2]};
+    lw_faces[3].vertex_ids = {v[3], v[0], v[1]};
+
+    for (auto& lw_face : lw_faces)
+      cell.faces.push_back(lw_face);
+  }
+  else if (element_type == 5) // 8-node hexahedron
+  {
+    auto& v = cell.vertex_ids;
+    std::vector<UnpartitionedMesh::LightWeightFace> lw_faces(6);
+    lw_faces[0].vertex_ids = {v[5], v[1], v[2], v[6]}; // East face
+    lw_faces[1].vertex_ids = {v[0], v[4], v[7], v[3]}; // West face
+    lw_faces[2].vertex_ids = {v[0], v[3], v[2], v[1]}; // North face
+    lw_faces[3].vertex_ids = {v[4], v[5], v[6], v[7]}; // South face
+    lw_faces[4].vertex_ids = {v[2], v[3], v[7], v[6]}; // Top face
+    lw_faces[5].vertex_ids = {v[0], v[1], v[5], v[4]}; // Bottom face
+
+    for (auto& lw_face : lw_faces)
+      cell.faces.push_back(lw_face);
+  }
+  else
+    throw std::runtime_error(fname + ": Unsupported cell type");
+
+  return raw_cell;
+}
+
+/**
+ * Returns the file offset of the first occurrence of each marker that starts within the
+ * `slice`-th of `num_slices` equal byte ranges of the file. Markers that do not start within the
+ * range get the maximum uint64_t value.
+ */
+std::vector<uint64_t>
+FindMarkersInSlice(std::ifstream& file,
+                   uint64_t file_size,
+                   const std::vector<std::string>& markers,
+                   int slice,
+                   int num_slices)
+{
+  size_t max_marker_length = 0;
+  for (const auto& marker : markers)
+    max_marker_length = std::max(max_marker_length, marker.size());
+
+  const uint64_t begin = file_size * slice / num_slices;
+  const uint64_t end = file_size * (slice + 1) / num_slices;
+
+  // Blocks overlap by the longest marker so that markers straddling two blocks are found
+  constexpr uint64_t block_size = 1 << 20;
+  std::vector<uint64_t> offsets(markers.size(), std::numeric_limits<uint64_t>::max());
+  std::string buffer;
+  for (uint64_t block_begin = begin; block_begin < end; block_begin += block_size)
+  {
+    const uint64_t block_end = std::min(block_begin + block_size, end);
+    const uint64_t read_end = std::min(file_size, block_end + max_marker_length - 1);
+    buffer.resize(read_end - block_begin);
+    file.clear();
+    file.seekg(static_cast<std::streamoff>(block_begin));
+    file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+    for (size_t m = 0; m < markers.size(); ++m)
+    {
+      if (offsets[m] != std::numeric_limits<uint64_t>::max())
+        continue;
+      const auto pos = buffer.find(markers[m]);
+      if (pos != std::string::npos and block_begin + pos < block_end)
+        offsets[m] = block_begin + pos;
+    }
+  }
+
+  return offsets;
+}
+
+/**
+ * Calls `process_line` for every line of the byte range [begin, end) of the file whose first
+ * character lies within the `slice`-th of `num_slices` equal parts of the range.
+ */
+template <typename LineFunction>
+void
+ForEachLineInSlice(std::ifstream& file,
+                   uint64_t begin,
+                   uint64_t end,
+                   int slice,
+                   int num_slices,
+                   LineFunction process_line)
+{
+  const uint64_t length = end - begin;
+  uint64_t line_begin = begin + length * slice / num_slices;
+  const uint64_t slice_end = begin + length * (slice + 1) / num_slices;
+  if (line_begin >= slice_end)
+    return;
+
+  file.clear();
+  std::string file_line;
+  if (line_begin > begin)
+  {
+    // Skip the remainder of a line started in the previous slice
+    file.seekg(static_cast<std::streamoff>(line_begin - 1));
+    std::getline(file, file_line);
+    line_begin += file_line.size();
+  }
+  else
+    file.seekg(static_cast<std::streamoff>(line_begin));
+
+  while (line_begin < slice_end and std::getline(file, file_line))
+  {
+    line_begin += file_line.size() + 1;
+    process_line(file_line);
+  }
+}
+
+/// Maps a set of ids, gathered over all locations, onto contiguous ids in ascending order.
+std::map<int, int>
+GlobalContiguousIdMapping(const std::set<int>& local_ids)
+{
+  std::vector<int> local_ids_vec(local_ids.begin(), local_ids.end());
+  std::vector<int> global_ids_vec;
+  mpi_comm.all_gather(local_ids_vec, global_ids_vec);
+
+  const std::set<int> global_ids(global_ids_vec.begin(), global_ids_vec.end());
+  std::map<int, int> mapping;
+  int m = 0;
+  for (const int id : global_ids)
+    mapping.insert(std::make_pair(id, m++));
+  return mapping;
+}
+
+} // namespace
+
 std::shared_ptr<UnpartitionedMesh>
 MeshIO::FromGmshV22(const UnpartitionedMesh::Options& options)
 {
@@ -69,45 +379,6 @@ MeshIO::FromGmshV22(const UnpartitionedMesh::Options& options)
     vertices[vert_index - 1] = {x, y, z};
   }
 
-  auto IsElementType1D = [](int type) { return type == 1; };
-  auto IsElementType2D = [](int type) { return type == 2 || type == 3; };
-  auto IsElementType3D = [](int type) { return type >= 4 && type <= 7; };
-  auto IsElementSupported = [](int type) { return type >= 1 && type <= 7; };
-  auto CellTypeFromMSHTypeID = [](int type)
-  {
-    switch (type)
-    {
-      case 1:
-        return CellType::SLAB;
-      case 2:
-        return CellType::TRIANGLE;
-      case 3:
-        return CellType::QUADRILATERAL;
-      case 4:
-        return CellType::TETRAHEDRON;
-      case 5:
-        return CellType::HEXAHEDRON;
-      case 6:
-      case 7:
-        return CellType::POLYHEDRON;
-      default:
-        return CellType::GHOST;
-    }
-  };
-  auto ReadNodes = [&iss, &fname](int num_nodes)
-  {
-    std::vector<int> raw_nodes(num_nodes, 0);
-    for (int i = 0; i < num_nodes; ++i)
-      if (not(iss >> raw_nodes[i]))
-        throw std::logic_error(fname + ": Failed reading element node index.");
-
-    std::vector<uint64_t> nodes(num_nodes, 0);
-    for (int i = 0; i < num_nodes; ++i)
-      if ((raw_nodes[i] - 1) >= 0)
-        nodes[i] = raw_nodes[i] - 1;
-    return nodes;
-  };
-
   // Determine dimension of mesh. Only 2D and 3D meshes are supported. If the mesh is 1D, no
   // elements will be read.
   bool mesh_is_2D = true;
@@ -165,139 +436,33 @@ MeshIO::FromGmshV22(const UnpartitionedMesh::Options& options)
   if (not(iss >> num_elems))
     throw std::logic_error(fname + ": Failed to read number of elements.");
 
+  auto& raw_boundary_cells = mesh->RawBoundaryCells();
+  auto& raw_cells = mesh->RawCells();
   for (int n = 0; n < num_elems; n++)
   {
     std::getline(file, file_line);
-    iss = std::istringstream(file_line);
-
-    int element_index, element_type, num_tags;
-    if (not(iss >> element_index >> element_type >> num_tags))
-      throw std::logic_error(fname + ": Failed reading element index, type, and number of tags.");
-
-    int physical_region;
-    if (not(iss >> physical_region))
-      throw std::logic_error(fname + ": Failed reading physical region.");
-
-    int tag;
-    for (int i = 1; i < num_tags; i++)
-      if (not(iss >> tag))
-        throw std::logic_error(fname + ": Failed reading tags.");
+    const auto element = ReadElement(file_line, fname);
 
     // Skip point type elements
-    if (element_type == 15)
+    if (element.type == 15)
       continue;
 
-    int num_cell_nodes = 0;
-    if (element_type == 1) // 2-node edge
-      num_cell_nodes = 2;
-    else if (element_type == 2) // 3-node triangle
-      num_cell_nodes = 3;
-    else if (element_type == 3 or element_type == 4) // 4-node quadrangle or tet
-      num_cell_nodes = 4;
-    else if (element_type == 5) // 8-node hexahedron
-      num_cell_nodes = 8;
-
-    auto& raw_boundary_cells = mesh->RawBoundaryCells();
-    auto& raw_cells = mesh->RawCells();
-
     // Make the cell on either the volume or the boundary
-    std::shared_ptr<UnpartitionedMesh::LightWeightCell> raw_cell;
-    if (mesh_is_2D)
-    {
-      if (IsElementType1D(element_type))
-      {
-        raw_cell =
-          std::make_shared<UnpartitionedMesh::LightWeightCell>(CellType::SLAB, CellType::SLAB);
-        raw_boundary_cells.push_back(raw_cell);
-        log.Log0Verbose2() << "Added to raw_boundary_cells.";
-      }
-      else if (IsElementType2D(element_type))
-      {
-        raw_cell = std::make_shared<UnpartitionedMesh::LightWeightCell>(
-          CellType::POLYGON, CellTypeFromMSHTypeID(element_type));
-        raw_cells.push_back(raw_cell);
-        log.Log0Verbose2() << "Added to raw_cells.";
-      }
-    }
-    else
-    {
-      if (IsElementType2D(element_type))
-      {
-        raw_cell = std::make_shared<UnpartitionedMesh::LightWeightCell>(
-          CellType::POLYGON, CellTypeFromMSHTypeID(element_type));
-        raw_boundary_cells.push_back(raw_cell);
-        log.Log0Verbose2() << "Added to raw_boundary_cells.";
-      }
-      else if (IsElementType3D(element_type))
-      {
-        raw_cell = std::make_shared<UnpartitionedMesh::LightWeightCell>(
-          CellType::POLYHEDRON, CellTypeFromMSHTypeID(element_type));
-        raw_cells.push_back(raw_cell);
-        log.Log0Verbose2() << "Added to raw_cells.";
-      }
-    }
-
+    bool is_boundary = false;
+    auto raw_cell = MakeCell(element, mesh_is_2D, is_boundary, fname);
     if (raw_cell == nullptr)
       continue;
 
-    auto& cell = *raw_cell;
-    cell.material_id = physical_region;
-    cell.vertex_ids = ReadNodes(num_cell_nodes);
-
-    // Populate faces
-    if (element_type == 1) // 2-node edge
-    {
-      UnpartitionedMesh::LightWeightFace face0;
-      UnpartitionedMesh::LightWeightFace face1;
-
-      face0.vertex_ids = {cell.vertex_ids.at(0)};
-      face1.vertex_ids = {cell.vertex_ids.at(1)};
-
-      cell.faces.push_back(face0);
-      cell.faces.push_back(face1);
-    }
-    else if (element_type == 2 or element_type == 3) // 3-node triangle or 4-node quadrangle
-    {
-      size_t num_verts = cell.vertex_ids.size();
-      for (size_t e = 0; e < num_verts; e++)
-      {
-        size_t ep1 = (e < (num_verts - 1)) ? e + 1 : 0;
-        UnpartitionedMesh::LightWeightFace face;
-
-        face.vertex_ids = {cell.vertex_ids[e], cell.vertex_ids[ep1]};
-
-        cell.faces.push_back(std::move(face));
-      }
-    }
-    else if (element_type == 4) // 4-node tetrahedron
+    if (is_boundary)
     {
-      auto& v = cell.vertex_ids;
-      std::vector<UnpartitionedMesh::LightWeightFace> lw_faces(4);
-      lw_faces[0].vertex_ids = {v[0], v[2], v[1]}; // base-face
-      lw_faces[1].vertex_ids = {v[0], v[3], v[2]};
-      lw_faces[2].vertex_ids = {v[3], v[1], v[2]};
-      lw_faces[3].vertex_ids = {v[3], v[0], v[1]};
-
-      for (auto& lw_face : lw_faces)
-        cell.faces.push_back(lw_face);
+      raw_boundary_cells.push_back(raw_cell);
+      log.Log0Verbose2() << "Added to raw_boundary_cells.";
     }
-    else if (element_type == 5) // 8-node hexahedron
+    else
     {
-      auto& v = cell.vertex_ids;
-      std::vector<UnpartitionedMesh::LightWeightFace> lw_faces(6);
-      lw_faces[0].vertex_ids = {v[5], v[1], v[2], v[6]}; // East face
-      lw_faces[1].vertex_ids = {v[0], v[4], v[7], v[3]}; // West face
-      lw_faces[2].vertex_ids = {v[0], v[3], v[2], v[1]}; // North face
-      lw_faces[3].vertex_ids = {v[4], v[5], v[6], v[7]}; // South face
-      lw_faces[4].vertex_ids = {v[2], v[3], v[7], v[6]}; // Top face
-      lw_faces[5].vertex_ids = {v[0], v[1], v[5], v[4]}; // Bottom face
-
-      for (auto& lw_face : lw_faces)
-        cell.faces.push_back(lw_face);
+      raw_cells.push_back(raw_cell);
+      log.Log0Verbose2() << "Added to raw_cells.";
     }
-    else
-      throw std::runtime_error(fname + ": Unsupported cell type");
-
   } // for elements
 
   file.close();
@@ -345,4 +510,144 @@ MeshIO::FromGmshV22(const UnpartitionedMesh::Options& options)
   return mesh;
 }
 
+MeshIO::MeshFileSlice
+MeshIO::FromGmshV22Slice(const UnpartitionedMesh::Options& options)
+{
+  const std::string fname = "MeshIO::FromGmshV22Slice";
+  const int slice = opensn::mpi_comm.rank();
+  const int num_slices = opensn::mpi_comm.size();
+
+  // Opening file
+  std::ifstream file(options.file_name, std::ios::binary);
+  if (not file.is_open())
+    throw std::runtime_error(fname + ": Failed to open file " + options.file_name);
+
+  log.Log() << "Making distributed mesh slices from Gmsh file " << options.file_name
+            << " (format v2.2)";
+
+  // Locate the sections. Every location searches its own part of the file.
+  const auto file_size = static_cast<uint64_t>(std::filesystem::file_size(options.file_name));
+  const std::vector<std::string> markers = {
+    "\n$Nodes", "\n$EndNodes", "\n$Elements", "\n$EndElements"};
+  const auto local_offsets = FindMarkersInSlice(file, file_size, markers, slice, num_slices);
+  std::vector<uint64_t> offsets(markers.size());
+  mpi_comm.all_reduce(local_offsets, offsets, mpi::op::min<uint64_t>());
+  for (size_t m = 0; m < markers.size(); ++m)
+    if (offsets[m] == std::numeric_limits<uint64_t>::max())
+      throw std::logic_error(fname + ": Failed to find the " + markers[m].substr(1) + " section.");
+
+  // Returns the count following a section header and the byte range of the section's data lines
+  auto ReadSectionHeader = [&file, &fname](uint64_t begin_offset, uint64_t end_offset)
+  {
+    std::string file_line;
+    file.clear();
+    file.seekg(static_cast<std::streamoff>(begin_offset + 1));
+    std::getline(file, file_line);
+    std::getline(file, file_line);
+    std::istringstream iss(file_line);
+    uint64_t count;
+    if (not(iss >> count))
+      throw std::logic_error(fname + ": Failed to read a section count.");
+    const auto data_begin = static_cast<uint64_t>(file.tellg());
+    return std::make_tuple(count, data_begin, end_offset + 1);
+  };
+
+  MeshFileSlice mesh_slice;
+
+  // Read node data
+  const auto [num_nodes, nodes_begin, nodes_end] = ReadSectionHeader(offsets[0], offsets[1]);
+  mesh_slice.num_global_vertices = num_nodes;
+  ForEachLineInSlice(file,
+                     nodes_begin,
+                     nodes_end,
+                     slice,
+                     num_slices,
+                     [&mesh_slice, &fname](const std::string& file_line)
+                     {
+                       std::istringstream iss(file_line);
+                       uint64_t vert_index;
+                       if (not(iss >> vert_index))
+                         throw std::logic_error(fname + ": Failed to read vertex index.");
+
+                       double x, y, z;
+                       if (not(iss >> x >> y >> z))
+                         throw std::logic_error(fname +
+                                                ": Failed while reading vertex coordinates.");
+                       mesh_slice.vertices[vert_index - 1] = Vector3(x, y, z);
+                     });
+
+  // Read element data
+  const auto [num_elems, elems_begin, elems_end] = ReadSectionHeader(offsets[2], offsets[3]);
+  std::vector<GmshElement> elements;
+  int local_has_3D_element = 0;
+  ForEachLineInSlice(file,
+                     elems_begin,
+                     elems_end,
+                     slice,
+                     num_slices,
+                     [&](const std::string& file_line)
+                     {
+                       auto element = ReadElement(file_line, fname);
+
+                       // Skip point type elements
+                       if (element.type == 15)
+                         return;
+
+                       if (not IsElementSupported(element.type))
+                         throw std::logic_error(fname + ": Found unsupported element type.");
+                       if (IsElementType3D(element.type))
+                         local_has_3D_element = 1;
+                       elements.push_back(std::move(element));
+                     });
+  file.close();
+
+  // Determine dimension of mesh. Only 2D and 3D meshes are supported.
+  int has_3D_element = 0;
+  mpi_comm.all_reduce(local_has_3D_element, has_3D_element, mpi::op::max<int>());
+  const bool mesh_is_2D = has_3D_element == 0;
+  if (not mesh_is_2D)
+    log.Log() << "Mesh identified as 3D.";
+
+  for (const auto& element : elements)
+  {
+    bool is_boundary = false;
+    auto raw_cell = MakeCell(element, mesh_is_2D, is_boundary, fname);
+    if (raw_cell == nullptr)
+      continue;
+
+    if (is_boundary)
+      mesh_slice.boundary_cells.push_back(raw_cell);
+    else
+      mesh_slice.cells.push_back(raw_cell);
+  }
+
+  // Remap material-ids consistently across all slices
+  std::set<int> material_ids_set_as_read;
+  for (const auto& cell : mesh_slice.cells)
+    material_ids_set_as_read.insert(cell->material_id);
+
+  std::set<int> boundary_ids_set_as_read;
+  for (const auto& cell : mesh_slice.boundary_cells)
+    boundary_ids_set_as_read.insert(cell->material_id);
+
+  const auto material_mapping = GlobalContiguousIdMapping(material_ids_set_as_read);
+  const auto boundary_mapping = GlobalContiguousIdMapping(boundary_ids_set_as_read);
+
+  for (auto& cell : mesh_slice.cells)
+    cell->material_id = material_mapping.at(cell->material_id);
+
+  for (auto& cell : mesh_slice.boundary_cells)
+    cell->material_id = boundary_mapping.at(cell->material_id);
+
+  mesh_slice.dimension = (mesh_is_2D) ? 2 : 3;
+
+  size_t num_global_cells = 0;
+  mpi_comm.all_reduce(mesh_slice.cells.size(), num_global_cells, mpi::op::sum<size_t>());
+  log.Log() << "Done processing " << options.file_name << ".\n"
+            << "Number of nodes read: " << num_nodes << "\n"
+            << "Number of cells read: " << num_global_cells;
+
+  return mesh_slice;
+}
+
 } // namespace opensn
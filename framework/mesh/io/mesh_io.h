@@ -12,6 +12,21 @@ namespace opensn
 class MeshIO
 {
 public:
+  /**
+   * The part of a mesh file read by one location. Cells are in file order, so the global id of a
+   * cell is its index plus the number of cells in the slices of all lower ranks.
+   */
+  struct MeshFileSlice
+  {
+    unsigned int dimension = 0;
+    /// Number of vertices in the whole file.
+    size_t num_global_vertices = 0;
+    std::vector<std::shared_ptr<UnpartitionedMesh::LightWeightCell>> cells;
+    std::vector<std::shared_ptr<UnpartitionedMesh::LightWeightCell>> boundary_cells;
+    /// The vertices read by this location, which generally are not those of its cells.
+    std::map<uint64_t, Vector3> vertices;
+  };
+
   static std::shared_ptr<UnpartitionedMesh> FromExodusII(const UnpartitionedMesh::Options& options);
   static std::shared_ptr<UnpartitionedMesh> FromVTU(const UnpartitionedMesh::Options& options);
   static std::shared_ptr<UnpartitionedMesh> FromPVTU(const UnpartitionedMesh::Options& options);
@@ -20,6 +35,13 @@ public:
   static std::shared_ptr<UnpartitionedMesh> FromOBJ(const UnpartitionedMesh::Options& options);
   static std::shared_ptr<UnpartitionedMesh> FromGmsh(const UnpartitionedMesh::Options& options);
 
+  /**
+   * Collectively reads a Gmsh file, with every location reading an equal share of its nodes and
+   * elements. Cells are not connected and the vertices of a cell may live on other locations.
+   * Only format 2.2 is supported.
+   */
+  static MeshFileSlice FromGmshSlice(const UnpartitionedMesh::Options& options);
+
   /**
    * Write grid cells into an OBJ file
    *
@@ -56,6 +78,7 @@ public:
 private:
   static std::shared_ptr<UnpartitionedMesh> FromGmshV41(const UnpartitionedMesh::Options& options);
   static std::shared_ptr<UnpartitionedMesh> FromGmshV22(const UnpartitionedMesh::Options& options);
+  static MeshFileSlice FromGmshV22Slice(const UnpartitionedMesh::Options& options);
 };
 
 } // namespace opensn
@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/mesh/mesh_continuum/cell_search_tree.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/mesh/cell/cell.h"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace opensn
+{
+
+namespace
+{
+
+constexpr size_t max_leaf_size = 8;
+
+} // namespace
+
+CellSearchTree::CellSearchTree(const MeshContinuum& grid)
+{
+  const size_t num_cells = grid.local_cells.size();
+  constexpr double inf = std::numeric_limits<double>::infinity();
+
+  // Cell boxes. CheckPointInsideCell ignores the coordinates a cell does not span (x and y for
+  // slabs, z for polygons), so the boxes are unbounded along those.
+  std::vector<Box> boxes(num_cells);
+  std::vector<Vector3> centers(num_cells);
+  for (const auto& cell : grid.local_cells)
+  {
+    auto& box = boxes[cell.local_id];
+    box.min = Vector3(inf, inf, inf);
+    box.max = Vector3(-inf, -inf, -inf);
+    for (uint64_t vid : cell.vertex_ids)
+    {
+      const auto& vertex = grid.vertices[vid];
+      box.min = Vector3(std::min(box.min.x, vertex.x),
+                        std::min(box.min.y, vertex.y),
+                        std::min(box.min.z, vertex.z));
+      box.max = Vector3(std::max(box.max.x, vertex.x),
+                        std::max(box.max.y, vertex.y),
+                        std::max(box.max.z, vertex.z));
+    }
+    centers[cell.local_id] = (box.min + box.max) / 2.0;
+
+    const double tolerance = 1.0e-8 * (box.max - box.min).Norm();
+    box.min = box.min - Vector3(tolerance, tolerance, tolerance);
+    box.max = box.max + Vector3(tolerance, tolerance, tolerance);
+    if (cell.Type() == CellType::SLAB)
+    {
+      box.min.x = box.min.y = -inf;
+      box.max.x = box.max.y = inf;
+    }
+    else if (cell.Type() == CellType::POLYGON)
+    {
+      box.min.z = -inf;
+      box.max.z = inf;
+    }
+  }
+
+  cell_ids_.resize(num_cells);
+  std::iota(cell_ids_.begin(), cell_ids_.end(), 0);
+  if (num_cells == 0)
+    return;
+
+  // Top-down build, splitting each range at the median cell center along its longest axis.
+  // Children are stored next to each other, so a node only needs the index of the first one.
+  struct Range
+  {
+    size_t node;
+    size_t begin;
+    size_t end;
+  };
+  nodes_.reserve(2 * (num_cells / max_leaf_size + 1));
+  nodes_.emplace_back();
+  std::vector<Range> stack = {{0, 0, num_cells}};
+  while (not stack.empty())
+  {
+    const auto [n, begin, end] = stack.back();
+    stack.pop_back();
+
+    Box box{Vector3(inf, inf, inf), Vector3(-inf, -inf, -inf)};
+    Box center_box = box;
+    for (size_t i = begin; i < end; ++i)
+    {
+      const auto& cell_box = boxes[cell_ids_[i]];
+      const auto& center = centers[cell_ids_[i]];
+      box.min = Vector3(std::min(box.min.x, cell_box.min.x),
+                        std::min(box.min.y, cell_box.min.y),
+                        std::min(box.min.z, cell_box.min.z));
+      box.max = Vector3(std::max(box.max.x, cell_box.max.x),
+                        std::max(box.max.y, cell_box.max.y),
+                        std::max(box.max.z, cell_box.max.z));
+      center_box.min = Vector3(std::min(center_box.min.x, center.x),
+                               std::min(center_box.min.y, center.y),
+                               std::min(center_box.min.z, center.z));
+      center_box.max = Vector3(std::max(center_box.max.x, center.x),
+                               std::max(center_box.max.y, center.y),
+                               std::max(center_box.max.z, center.z));
+    }
+    nodes_[n].box = box;
+
+    const auto extent = center_box.max - center_box.min;
+    const int axis = (extent.x >= extent.y and extent.x >= extent.z) ? 0
+                     : (extent.y >= extent.z)                        ? 1
+                                                                     : 2;
+    if (end - begin <= max_leaf_size or extent[axis] <= 0.0)
+    {
+      nodes_[n].first = static_cast<uint32_t>(begin);
+      nodes_[n].count = static_cast<uint32_t>(end - begin);
+      continue;
+    }
+
+    const size_t mid = begin + (end - begin) / 2;
+    std::nth_element(cell_ids_.begin() + begin,
+                     cell_ids_.begin() + mid,
+                     cell_ids_.begin() + end,
+                     [&centers, axis](uint64_t a, uint64_t b)
+                     { return centers[a][axis] < centers[b][axis]; });
+
+    const size_t left = nodes_.size();
+    nodes_[n].first = static_cast<uint32_t>(left);
+    nodes_.emplace_back();
+    nodes_.emplace_back();
+    stack.push_back({left, begin, mid});
+    stack.push_back({left + 1, mid, end});
+  }
+
+  cell_boxes_.reserve(num_cells);
+  for (uint64_t cell_id : cell_ids_)
+    cell_boxes_.push_back(boxes[cell_id]);
+}
+
+void
+CellSearchTree::FindCandidateCells(const Vector3& point,
+                                   std::vector<uint64_t>& cell_local_ids) const
+{
+  if (nodes_.empty())
+    return;
+
+  std::vector<uint32_t> stack = {0};
+  while (not stack.empty())
+  {
+    const auto& node = nodes_[stack.back()];
+    stack.pop_back();
+    if (not node.box.Contains(point))
+      continue;
+
+    if (node.count > 0)
+    {
+      for (uint32_t i = node.first; i < node.first + node.count; ++i)
+        if (cell_boxes_[i].Contains(point))
+          cell_local_ids.push_back(cell_ids_[i]);
+    }
+    else
+    {
+      stack.push_back(node.first + 1);
+      stack.push_back(node.first);
+    }
+  }
+}
+
+} // namespace opensn
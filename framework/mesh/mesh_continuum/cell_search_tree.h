@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "framework/mesh/mesh.h"
+#include <cstdint>
+#include <vector>
+
+namespace opensn
+{
+class MeshContinuum;
+
+/**
+ * Bounding volume hierarchy over the bounding boxes of the local cells of a grid. Used to find
+ * the cells that may contain a point without visiting every local cell.
+ */
+class CellSearchTree
+{
+public:
+  explicit CellSearchTree(const MeshContinuum& grid);
+
+  /**
+   * Appends to `cell_local_ids` the local ids of the cells whose bounding box contains the point.
+   * Boxes are slightly inflated so that points on a cell boundary are not missed.
+   */
+  void FindCandidateCells(const Vector3& point, std::vector<uint64_t>& cell_local_ids) const;
+
+private:
+  struct Box
+  {
+    Vector3 min;
+    Vector3 max;
+
+    bool Contains(const Vector3& point) const
+    {
+      return point.x >= min.x and point.x <= max.x and point.y >= min.y and point.y <= max.y and
+             point.z >= min.z and point.z <= max.z;
+    }
+  };
+
+  /// A node is a leaf over `count` cells starting at `first`, or has children `first`, `first+1`.
+  struct Node
+  {
+    Box box;
+    uint32_t first = 0;
+    uint32_t count = 0;
+  };
+
+  /// Cell local ids in leaf order.
+  std::vector<uint64_t> cell_ids_;
+  /// Cell bounding boxes in leaf order.
+  std::vector<Box> cell_boxes_;
+  std::vector<Node> nodes_;
+};
+
+} // namespace opensn
@@ -4,6 +4,7 @@
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/mesh/mesh_continuum/grid_face_histogram.h"
 #include "framework/mesh/mesh_continuum/grid_vtk_utils.h"
+#include "framework/mesh/mesh_continuum/cell_search_tree.h"
 #include "framework/mesh/logical_volume/logical_volume.h"
 #include "framework/mesh/cell/cell.h"
 #include "framework/data_types/ndarray.h"
@@ -22,7 +23,8 @@ MeshContinuum::MeshContinuum()
     cells(local_cells_,
           ghost_cells_,
           global_cell_id_to_local_id_map_,
-          global_cell_id_to_nonlocal_id_map_),
+          global_cell_id_to_nonlocal_id_map_,
+          cell_search_tree_),
     dim_(0),
     mesh_type_(UNSTRUCTURED),
     extruded_(false),
@@ -208,12 +210,7 @@ MeshContinuum::MakeGridFaceHistogram(double master_tolerance, double slave_toler
 bool
 MeshContinuum::IsCellLocal(uint64_t cell_global_index) const
 {
-  auto native_index = global_cell_id_to_local_id_map_.find(cell_global_index);
-
-  if (native_index != global_cell_id_to_local_id_map_.end())
-    return true;
-
-  return false;
+  return global_cell_id_to_local_id_map_.Contains(cell_global_index);
 }
 
 int
@@ -355,7 +352,7 @@ MeshContinuum::MapCellFace(const Cell& cur_cell, const Cell& adj_cell, unsigned
 size_t
 MeshContinuum::MapCellGlobalID2LocalID(uint64_t global_id) const
 {
-  return global_cell_id_to_local_id_map_.at(global_id);
+  return global_cell_id_to_local_id_map_.At(global_id);
 }
 
 Vector3
@@ -461,6 +458,43 @@ MeshContinuum::CheckPointInsideCell(const Cell& cell, const Vector3& point) cons
   return true;
 }
 
+const CellSearchTree&
+MeshContinuum::GetCellSearchTree() const
+{
+  if (not cell_search_tree_)
+    cell_search_tree_ = std::make_shared<CellSearchTree>(*this);
+  return *cell_search_tree_;
+}
+
+std::vector<uint64_t>
+MeshContinuum::FindCandidateCells(const Vector3& point) const
+{
+  std::vector<uint64_t> cell_local_ids;
+  GetCellSearchTree().FindCandidateCells(point, cell_local_ids);
+  std::sort(cell_local_ids.begin(), cell_local_ids.end());
+  return cell_local_ids;
+}
+
+std::vector<std::vector<uint64_t>>
+MeshContinuum::FindContainingCells(const std::vector<Vector3>& points) const
+{
+  const auto& tree = GetCellSearchTree();
+
+  std::vector<std::vector<uint64_t>> containing_cells(points.size());
+  std::vector<uint64_t> candidates;
+  for (size_t p = 0; p < points.size(); ++p)
+  {
+    candidates.clear();
+    tree.FindCandidateCells(points[p], candidates);
+    std::sort(candidates.begin(), candidates.end());
+    for (uint64_t cell_local_id : candidates)
+      if (CheckPointInsideCell(*local_cells_[cell_local_id], points[p]))
+        containing_cells[p].push_back(cell_local_id);
+  }
+
+  return containing_cells;
+}
+
 std::array<size_t, 3>
 MeshContinuum::GetIJKInfo() const
 {
@@ -10,11 +10,13 @@
 #include "framework/mesh/mesh_continuum/mesh_continuum_vertex_handler.h"
 #include <memory>
 #include <array>
+#include <map>
 
 namespace opensn
 {
 class MPICommunicatorSet;
 class GridFaceHistogram;
+class CellSearchTree;
 class MeshGenerator;
 
 /**
@@ -50,11 +52,20 @@ public:
   {
     local_cells_.clear();
     ghost_cells_.clear();
-    global_cell_id_to_local_id_map_.clear();
-    global_cell_id_to_nonlocal_id_map_.clear();
+    global_cell_id_to_local_id_map_.Clear();
+    global_cell_id_to_nonlocal_id_map_.Clear();
     vertices.Clear();
+    InvalidateCellSearchTree();
   }
 
+  /**
+   * Drops the bounding volume hierarchy used for point location so that it is rebuilt on the next
+   * query. Adding local cells does this automatically, as does
+   * Cell::RecomputeCentroidsAndNormals. Code that moves vertices without recomputing the cell
+   * geometry must call it before locating points again.
+   */
+  void InvalidateCellSearchTree() const { cell_search_tree_.reset(); }
+
   /**
    * Populates a face histogram.
    *
@@ -141,6 +152,20 @@ public:
    */
   bool CheckPointInsideCell(const Cell& cell, const Vector3& point) const;
 
+  /**
+   * Returns, for each point, the local ids, in ascending order, of the local cells containing it.
+   * A point on a shared face, edge or vertex is contained by every cell sharing it. Cells are
+   * searched through a bounding volume hierarchy that is built on first use and kept until
+   * InvalidateCellSearchTree is called.
+   */
+  std::vector<std::vector<uint64_t>> FindContainingCells(const std::vector<Vector3>& points) const;
+
+  /**
+   * Returns the local ids, in ascending order, of the local cells whose bounding box contains the
+   * point. Callers apply their own containment test to these candidates.
+   */
+  std::vector<uint64_t> FindCandidateCells(const Vector3& point) const;
+
   MeshType Type() const { return mesh_type_; }
 
   void SetType(MeshType type) { mesh_type_ = type; }
@@ -204,8 +229,13 @@ private:
   std::vector<std::unique_ptr<Cell>> local_cells_; ///< Actual local cells
   std::vector<std::unique_ptr<Cell>> ghost_cells_; ///< Locally stored ghosts
 
-  std::map<uint64_t, uint64_t> global_cell_id_to_local_id_map_;
-  std::map<uint64_t, uint64_t> global_cell_id_to_nonlocal_id_map_;
+  IndexMap global_cell_id_to_local_id_map_;
+  IndexMap global_cell_id_to_nonlocal_id_map_;
+
+  /// Returns the point search tree, building it if it was invalidated or never built.
+  const CellSearchTree& GetCellSearchTree() const;
+
+  mutable std::shared_ptr<CellSearchTree> cell_search_tree_;
 };
 
 } // namespace opensn
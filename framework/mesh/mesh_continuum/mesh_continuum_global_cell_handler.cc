@@ -19,8 +19,9 @@ GlobalCellHandler::push_back(std::unique_ptr<Cell> new_cell)
 
     const auto& cell = local_cells_ref_.back();
 
-    global_cell_id_to_native_id_map_.insert(
-      std::make_pair(cell->global_id, local_cells_ref_.size() - 1));
+    global_cell_id_to_native_id_map_.Insert(cell->global_id, local_cells_ref_.size() - 1);
+
+    cell_search_tree_ref_.reset();
   }
   else
   {
@@ -28,24 +29,17 @@ GlobalCellHandler::push_back(std::unique_ptr<Cell> new_cell)
 
     const auto& cell = ghost_cells_ref_.back();
 
-    global_cell_id_to_foreign_id_map_.insert(
-      std::make_pair(cell->global_id, ghost_cells_ref_.size() - 1));
+    global_cell_id_to_foreign_id_map_.Insert(cell->global_id, ghost_cells_ref_.size() - 1);
   }
 }
 
 Cell&
 GlobalCellHandler::operator[](uint64_t cell_global_index)
 {
-  auto native_location = global_cell_id_to_native_id_map_.find(cell_global_index);
-
-  if (native_location != global_cell_id_to_native_id_map_.end())
-    return *local_cells_ref_[native_location->second];
-  else
-  {
-    auto foreign_location = global_cell_id_to_foreign_id_map_.find(cell_global_index);
-    if (foreign_location != global_cell_id_to_foreign_id_map_.end())
-      return *ghost_cells_ref_[foreign_location->second];
-  }
+  if (const auto native_location = global_cell_id_to_native_id_map_.Find(cell_global_index))
+    return *local_cells_ref_[*native_location];
+  if (const auto foreign_location = global_cell_id_to_foreign_id_map_.Find(cell_global_index))
+    return *ghost_cells_ref_[*foreign_location];
 
   std::stringstream ostr;
   ostr << "MeshContinuum::cells. Mapping error."
@@ -58,16 +52,10 @@ GlobalCellHandler::operator[](uint64_t cell_global_index)
 const Cell&
 GlobalCellHandler::operator[](uint64_t cell_global_index) const
 {
-  auto native_location = global_cell_id_to_native_id_map_.find(cell_global_index);
-
-  if (native_location != global_cell_id_to_native_id_map_.end())
-    return *local_cells_ref_[native_location->second];
-  else
-  {
-    auto foreign_location = global_cell_id_to_foreign_id_map_.find(cell_global_index);
-    if (foreign_location != global_cell_id_to_foreign_id_map_.end())
-      return *ghost_cells_ref_[foreign_location->second];
-  }
+  if (const auto native_location = global_cell_id_to_native_id_map_.Find(cell_global_index))
+    return *local_cells_ref_[*native_location];
+  if (const auto foreign_location = global_cell_id_to_foreign_id_map_.Find(cell_global_index))
+    return *ghost_cells_ref_[*foreign_location];
 
   std::stringstream ostr;
   ostr << "MeshContinuum::cells. Mapping error."
@@ -92,10 +80,8 @@ GlobalCellHandler::GetGhostGlobalIDs() const
 uint64_t
 GlobalCellHandler::GetGhostLocalID(uint64_t cell_global_index) const
 {
-  auto foreign_location = global_cell_id_to_foreign_id_map_.find(cell_global_index);
-
-  if (foreign_location != global_cell_id_to_foreign_id_map_.end())
-    return foreign_location->second;
+  if (const auto foreign_location = global_cell_id_to_foreign_id_map_.Find(cell_global_index))
+    return *foreign_location;
 
   std::stringstream ostr;
   ostr << "Grid GetGhostLocalID failed to find cell " << cell_global_index;
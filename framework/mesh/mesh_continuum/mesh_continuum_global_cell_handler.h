@@ -4,10 +4,12 @@
 #pragma once
 
 #include "framework/mesh/cell/cell.h"
-#include <map>
+#include "framework/data_types/index_map.h"
+#include <memory>
 
 namespace opensn
 {
+class CellSearchTree;
 
 /// Handles all global index queries.
 class GlobalCellHandler
@@ -18,18 +20,23 @@ private:
   std::vector<std::unique_ptr<Cell>>& local_cells_ref_;
   std::vector<std::unique_ptr<Cell>>& ghost_cells_ref_;
 
-  std::map<uint64_t, uint64_t>& global_cell_id_to_native_id_map_;
-  std::map<uint64_t, uint64_t>& global_cell_id_to_foreign_id_map_;
+  IndexMap& global_cell_id_to_native_id_map_;
+  IndexMap& global_cell_id_to_foreign_id_map_;
+
+  /// The grid's point search tree, dropped whenever a local cell is added.
+  std::shared_ptr<CellSearchTree>& cell_search_tree_ref_;
 
 private:
   explicit GlobalCellHandler(std::vector<std::unique_ptr<Cell>>& native_cells,
                              std::vector<std::unique_ptr<Cell>>& foreign_cells,
-                             std::map<uint64_t, uint64_t>& global_cell_id_to_native_id_map,
-                             std::map<uint64_t, uint64_t>& global_cell_id_to_foreign_id_map)
+                             IndexMap& global_cell_id_to_native_id_map,
+                             IndexMap& global_cell_id_to_foreign_id_map,
+                             std::shared_ptr<CellSearchTree>& cell_search_tree)
     : local_cells_ref_(native_cells),
       ghost_cells_ref_(foreign_cells),
       global_cell_id_to_native_id_map_(global_cell_id_to_native_id_map),
-      global_cell_id_to_foreign_id_map_(global_cell_id_to_foreign_id_map)
+      global_cell_id_to_foreign_id_map_(global_cell_id_to_foreign_id_map),
+      cell_search_tree_ref_(cell_search_tree)
   {
   }
 
@@ -43,7 +50,7 @@ public:
   /// Returns a const reference to a cell given its global cell index.
   const Cell& operator[](uint64_t cell_global_index) const;
 
-  size_t GetNumGhosts() const { return global_cell_id_to_foreign_id_map_.size(); }
+  size_t GetNumGhosts() const { return global_cell_id_to_foreign_id_map_.Size(); }
 
   /**
    * Returns the cell global ids of all ghost cells. These are cells that neighbors to this
@@ -4,44 +4,67 @@
 #pragma once
 
 #include "framework/mesh/mesh_vector.h"
-#include <map>
+#include "framework/data_types/index_map.h"
+#include <utility>
+#include <vector>
 
 namespace opensn
 {
 
-/// Manages a vertex map with custom calls.
+/**
+ * Manages the locally stored vertices. Vertices are kept contiguously, in insertion order, and
+ * are found from their global id through a flat hash index.
+ */
 class VertexHandler
 {
-  using GlobalIDMap = std::map<uint64_t, Vector3>;
+  using GlobalIDVertexList = std::vector<std::pair<uint64_t, Vector3>>;
 
 private:
-  std::map<uint64_t, Vector3> m_global_id_vertex_map_;
+  GlobalIDVertexList vertices_;
+  IndexMap global_id_to_index_map_;
 
 public:
   // Iterators
-  GlobalIDMap::iterator begin() { return m_global_id_vertex_map_.begin(); }
-  GlobalIDMap::iterator end() { return m_global_id_vertex_map_.end(); }
+  GlobalIDVertexList::iterator begin() { return vertices_.begin(); }
+  GlobalIDVertexList::iterator end() { return vertices_.end(); }
 
-  GlobalIDMap::const_iterator begin() const { return m_global_id_vertex_map_.begin(); }
-  GlobalIDMap::const_iterator end() const { return m_global_id_vertex_map_.end(); }
+  GlobalIDVertexList::const_iterator begin() const { return vertices_.begin(); }
+  GlobalIDVertexList::const_iterator end() const { return vertices_.end(); }
 
   // Accessors
-  Vector3& operator[](const uint64_t global_id) { return m_global_id_vertex_map_.at(global_id); }
+  Vector3& operator[](const uint64_t global_id)
+  {
+    return vertices_[global_id_to_index_map_.At(global_id)].second;
+  }
 
   const Vector3& operator[](const uint64_t global_id) const
   {
-    return m_global_id_vertex_map_.at(global_id);
+    return vertices_[global_id_to_index_map_.At(global_id)].second;
   }
 
   // Utilities
+  /// Adds a vertex. Vertices that are already stored are left unchanged.
   void Insert(const uint64_t global_id, const Vector3& vec)
   {
-    m_global_id_vertex_map_.insert(std::make_pair(global_id, vec));
+    if (global_id_to_index_map_.Insert(global_id, vertices_.size()))
+      vertices_.emplace_back(global_id, vec);
   }
 
-  size_t NumLocallyStored() const { return m_global_id_vertex_map_.size(); }
+  /// Reserves storage for `num_vertices` vertices.
+  void Reserve(const size_t num_vertices)
+  {
+    vertices_.reserve(num_vertices);
+    global_id_to_index_map_.Reserve(num_vertices);
+  }
 
-  void Clear() { m_global_id_vertex_map_.clear(); }
+  size_t NumLocallyStored() const { return vertices_.size(); }
+
+  void Clear()
+  {
+    vertices_.clear();
+    vertices_.shrink_to_fit();
+    global_id_to_index_map_.Clear();
+  }
 };
 
 } // namespace opensn
@@ -0,0 +1,525 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/mesh/mesh_generator/distributed_file_mesh_generator.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/graphs/graph_partitioner.h"
+#include "framework/data_types/byte_array.h"
+#include "framework/mpi/mpi_utils.h"
+#include "framework/logging/log.h"
+#include "framework/utils/timer.h"
+#include "framework/utils/utils.h"
+#include "framework/object_factory.h"
+#include "framework/runtime.h"
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <numeric>
+
+namespace opensn
+{
+
+OpenSnRegisterObjectInNamespace(mesh, DistributedFileMeshGenerator);
+
+InputParameters
+DistributedFileMeshGenerator::GetInputParameters()
+{
+  InputParameters params = MeshGenerator::GetInputParameters();
+
+  params.SetGeneralDescription(
+    "Reads a mesh file in slices on all locations and partitions it in parallel, without "
+    "building the whole mesh on any location. Only Gmsh format 2.2 files are supported.");
+  params.SetDocGroup("doc_MeshGenerators");
+
+  params.AddRequiredParameter<std::string>("filename", "Path to the file.");
+
+  return params;
+}
+
+DistributedFileMeshGenerator::DistributedFileMeshGenerator(const InputParameters& params)
+  : MeshGenerator(params), filename_(params.GetParamValue<std::string>("filename"))
+{
+}
+
+void
+DistributedFileMeshGenerator::Execute()
+{
+  OpenSnInvalidArgumentIf(not inputs_.empty(),
+                          "DistributedFileMeshGenerator can not be preceded by another"
+                          " mesh generator because it cannot process an input mesh");
+  OpenSnInvalidArgumentIf(replicated_,
+                          "DistributedFileMeshGenerator does not support replicated meshes.");
+
+  const std::filesystem::path filepath(filename_);
+  const std::string extension = filepath.extension();
+  OpenSnInvalidArgumentIf(extension != ".msh",
+                          "Unsupported file type \"" + extension +
+                            "\". DistributedFileMeshGenerator only supports .msh files.");
+  AssertReadableFile(filename_);
+
+  const int num_parts = opensn::mpi_comm.size();
+  log.Log() << program_timer.GetTimeString() << " Reading and partitioning mesh with " << num_parts
+            << " parts";
+
+  UnpartitionedMesh::Options options;
+  options.file_name = filename_;
+  options.scale = scale_;
+  auto slice = MeshIO::FromGmshSlice(options);
+
+  const uint64_t first_cell_id = BalanceCells(slice);
+  const auto vertices = FetchVertices(slice);
+
+  for (auto& cell : slice.cells)
+  {
+    cell->centroid = Vector3(0.0, 0.0, 0.0);
+    for (uint64_t vid : cell->vertex_ids)
+      cell->centroid += vertices.at(vid);
+    cell->centroid = cell->centroid / static_cast<double>(cell->vertex_ids.size());
+  }
+
+  ConnectCells(slice, first_cell_id);
+
+  // Build the local rows of the cell graph and partition it
+  const size_t num_local_cells = slice.cells.size();
+  size_t num_global_cells = 0;
+  mpi_comm.all_reduce(num_local_cells, num_global_cells, mpi::op::sum<size_t>());
+
+  std::vector<std::vector<uint64_t>> cell_graph;
+  std::vector<Vector3> cell_centroids;
+  cell_graph.reserve(num_local_cells);
+  cell_centroids.reserve(num_local_cells);
+  for (const auto& cell : slice.cells)
+  {
+    std::vector<uint64_t> cell_graph_node;
+    for (const auto& face : cell->faces)
+      if (face.has_neighbor)
+        cell_graph_node.push_back(face.neighbor);
+
+    cell_graph.push_back(std::move(cell_graph_node));
+    cell_centroids.push_back(cell->centroid);
+  }
+
+  std::vector<double> cell_weights;
+  std::vector<std::vector<double>> edge_weights;
+  BuildPartitionWeights(slice.cells, first_cell_id, num_global_cells, cell_weights, edge_weights);
+
+  const auto cell_pids = partitioner_->PartitionDistributed(
+    cell_graph, cell_centroids, num_parts, cell_weights, edge_weights);
+
+  // Report the weighted load balance
+  int has_cell_weights = cell_weights.empty() ? 0 : 1;
+  mpi_comm.all_reduce(has_cell_weights, mpi::op::max<int>());
+  if (has_cell_weights)
+  {
+    std::vector<double> local_partition_weights(num_parts, 0.0);
+    for (size_t c = 0; c < cell_weights.size(); ++c)
+      local_partition_weights[cell_pids[c]] += cell_weights[c];
+    std::vector<double> partition_weights(num_parts, 0.0);
+    mpi_comm.all_reduce(local_partition_weights, partition_weights, mpi::op::sum<double>());
+
+    const double max_weight = *std::max_element(partition_weights.begin(), partition_weights.end());
+    const double avg_weight =
+      std::accumulate(partition_weights.begin(), partition_weights.end(), 0.0) / num_parts;
+    if (avg_weight > 0.0)
+      log.Log0Verbose1() << "Partition weight imbalance (max/avg): " << max_weight / avg_weight;
+  }
+
+  auto grid_ptr = MigrateCells(slice, first_cell_id, cell_pids, vertices);
+  mesh_stack.push_back(grid_ptr);
+
+  opensn::mpi_comm.barrier();
+
+  log.Log() << program_timer.GetTimeString() << " Mesh successfully distributed";
+}
+
+uint64_t
+DistributedFileMeshGenerator::BalanceCells(MeshIO::MeshFileSlice& slice)
+{
+  const int num_locations = opensn::mpi_comm.size();
+  const auto extents = BuildLocationExtents(slice.cells.size(), mpi_comm);
+  const uint64_t num_global_cells = extents.back();
+  auto BlockBegin = [num_global_cells, num_locations](int location)
+  { return num_global_cells * location / num_locations; };
+
+  // Global ids increase along the slice, so destinations do too
+  std::map<int, ByteArray> serial_data;
+  int dest = 0;
+  for (size_t c = 0; c < slice.cells.size(); ++c)
+  {
+    const uint64_t cell_global_id = extents[opensn::mpi_comm.rank()] + c;
+    while (BlockBegin(dest + 1) <= cell_global_id)
+      ++dest;
+
+    auto& dest_data = serial_data[dest];
+    dest_data.Write(cell_global_id);
+    SerializeCell(dest_data, *slice.cells[c]);
+  }
+
+  std::map<int, std::vector<std::byte>> send_data;
+  for (auto& [pid, pid_data] : serial_data)
+    send_data[pid] = std::move(pid_data.Data());
+  const auto recv_data = MapAllToAll(send_data);
+
+  std::map<uint64_t, std::shared_ptr<UnpartitionedMesh::LightWeightCell>> cells;
+  for (const auto& [pid, pid_data] : recv_data)
+  {
+    ByteArray pid_serial_data(pid_data);
+    while (not pid_serial_data.EndOfBuffer())
+    {
+      const auto cell_global_id = pid_serial_data.Read<uint64_t>();
+      cells[cell_global_id] = DeserializeCell(pid_serial_data);
+    }
+  }
+
+  slice.cells.clear();
+  slice.cells.reserve(cells.size());
+  for (auto& [cell_global_id, cell] : cells)
+    slice.cells.push_back(std::move(cell));
+
+  return BlockBegin(opensn::mpi_comm.rank());
+}
+
+std::map<uint64_t, Vector3>
+DistributedFileMeshGenerator::FetchVertices(const MeshIO::MeshFileSlice& slice) const
+{
+  const int num_locations = opensn::mpi_comm.size();
+  auto HomeLocation = [num_locations](uint64_t vid)
+  { return static_cast<int>(vid % num_locations); };
+
+  // Move the vertices read from the file to their home location
+  std::map<int, std::vector<uint64_t>> send_ids;
+  std::map<int, std::vector<double>> send_coords;
+  for (const auto& [vid, vertex] : slice.vertices)
+  {
+    const int home = HomeLocation(vid);
+    send_ids[home].push_back(vid);
+    auto& coords = send_coords[home];
+    coords.push_back(vertex.x);
+    coords.push_back(vertex.y);
+    coords.push_back(vertex.z);
+  }
+  const auto recv_ids = MapAllToAll(send_ids);
+  const auto recv_coords = MapAllToAll(send_coords);
+
+  std::map<uint64_t, Vector3> home_vertices;
+  for (const auto& [pid, ids] : recv_ids)
+  {
+    const auto& coords = recv_coords.at(pid);
+    for (size_t i = 0; i < ids.size(); ++i)
+      home_vertices[ids[i]] = Vector3(coords[3 * i], coords[3 * i + 1], coords[3 * i + 2]);
+  }
+
+  // Request the vertices of the local cells from their home locations
+  std::set<uint64_t> needed_vids;
+  for (const auto& cell : slice.cells)
+    needed_vids.insert(cell->vertex_ids.begin(), cell->vertex_ids.end());
+
+  std::map<int, std::vector<uint64_t>> requests;
+  for (uint64_t vid : needed_vids)
+    requests[HomeLocation(vid)].push_back(vid);
+  const auto recv_requests = MapAllToAll(requests);
+
+  std::map<int, std::vector<double>> replies;
+  for (const auto& [pid, ids] : recv_requests)
+  {
+    auto& coords = replies[pid];
+    coords.reserve(3 * ids.size());
+    for (uint64_t vid : ids)
+    {
+      const auto it = home_vertices.find(vid);
+      OpenSnLogicalErrorIf(it == home_vertices.end(),
+                           "Vertex " + std::to_string(vid) + " is not defined in the mesh file.");
+      coords.push_back(it->second.x * scale_);
+      coords.push_back(it->second.y * scale_);
+      coords.push_back(it->second.z * scale_);
+    }
+  }
+  const auto recv_replies = MapAllToAll(replies);
+
+  std::map<uint64_t, Vector3> vertices;
+  for (const auto& [pid, ids] : requests)
+  {
+    const auto& coords = recv_replies.at(pid);
+    for (size_t i = 0; i < ids.size(); ++i)
+      vertices[ids[i]] = Vector3(coords[3 * i], coords[3 * i + 1], coords[3 * i + 2]);
+  }
+
+  return vertices;
+}
+
+void
+DistributedFileMeshGenerator::ConnectCells(MeshIO::MeshFileSlice& slice, uint64_t first_cell_id)
+{
+  const int num_locations = opensn::mpi_comm.size();
+  auto HomeLocation = [num_locations](const std::vector<uint64_t>& key)
+  {
+    uint64_t hash = 14695981039346656037ULL;
+    for (uint64_t vid : key)
+    {
+      hash ^= vid;
+      hash *= 1099511628211ULL;
+    }
+    return static_cast<int>(hash % num_locations);
+  };
+
+  // Send every face and boundary element to the home location of its sorted vertex ids. A record
+  // is a flag telling faces from boundary elements, the key size, the key and two values: the
+  // cell global id and face index of a face, or the boundary id of a boundary element.
+  std::map<int, std::vector<uint64_t>> records;
+  auto AddRecord = [&records, &HomeLocation](
+                     uint64_t is_boundary, std::vector<uint64_t> key, uint64_t a, uint64_t b)
+  {
+    std::sort(key.begin(), key.end());
+    auto& home_records = records[HomeLocation(key)];
+    home_records.push_back(is_boundary);
+    home_records.push_back(key.size());
+    home_records.insert(home_records.end(), key.begin(), key.end());
+    home_records.push_back(a);
+    home_records.push_back(b);
+  };
+  for (size_t c = 0; c < slice.cells.size(); ++c)
+  {
+    const auto& cell = *slice.cells[c];
+    for (size_t f = 0; f < cell.faces.size(); ++f)
+      AddRecord(0, cell.faces[f].vertex_ids, first_cell_id + c, f);
+  }
+  for (const auto& bndry_cell : slice.boundary_cells)
+    AddRecord(1, bndry_cell->vertex_ids, static_cast<uint64_t>(bndry_cell->material_id), 0);
+  const auto recv_records = MapAllToAll(records);
+
+  // Match the faces on their home location. The sides of a face are the source location, cell
+  // global id and face index of each cell sharing it.
+  std::map<std::vector<uint64_t>, std::vector<std::array<uint64_t, 3>>> face_sides;
+  std::map<std::vector<uint64_t>, uint64_t> boundary_ids;
+  for (const auto& [pid, pid_records] : recv_records)
+  {
+    size_t i = 0;
+    while (i < pid_records.size())
+    {
+      const bool is_boundary = pid_records[i++] != 0;
+      const auto key_size = pid_records[i++];
+      std::vector<uint64_t> key(pid_records.begin() + i, pid_records.begin() + i + key_size);
+      i += key_size;
+      const auto a = pid_records[i++];
+      const auto b = pid_records[i++];
+
+      if (is_boundary)
+        boundary_ids[std::move(key)] = a;
+      else
+        face_sides[std::move(key)].push_back({static_cast<uint64_t>(pid), a, b});
+    }
+  }
+
+  // Reply with the neighbor of every matched face. A reply is the cell global id, the face index,
+  // whether the neighbor is a cell and the neighbor cell global id or boundary id.
+  std::map<int, std::vector<uint64_t>> replies;
+  auto AddReply = [&replies](const std::array<uint64_t, 3>& side, bool has_neighbor, uint64_t id)
+  {
+    auto& pid_replies = replies[static_cast<int>(side[0])];
+    pid_replies.push_back(side[1]);
+    pid_replies.push_back(side[2]);
+    pid_replies.push_back(has_neighbor ? 1 : 0);
+    pid_replies.push_back(id);
+  };
+  for (const auto& [key, sides] : face_sides)
+  {
+    OpenSnLogicalErrorIf(sides.size() > 2, "A face is shared by more than two cells.");
+    if (sides.size() == 2)
+    {
+      AddReply(sides[0], true, sides[1][1]);
+      AddReply(sides[1], true, sides[0][1]);
+    }
+    else
+    {
+      const auto it = boundary_ids.find(key);
+      if (it != boundary_ids.end())
+        AddReply(sides[0], false, it->second);
+    }
+  }
+  const auto recv_replies = MapAllToAll(replies);
+
+  for (const auto& [pid, pid_replies] : recv_replies)
+    for (size_t i = 0; i < pid_replies.size(); i += 4)
+    {
+      auto& face = slice.cells[pid_replies[i] - first_cell_id]->faces[pid_replies[i + 1]];
+      face.has_neighbor = pid_replies[i + 2] != 0;
+      face.neighbor = pid_replies[i + 3];
+    }
+}
+
+std::shared_ptr<MeshContinuum>
+DistributedFileMeshGenerator::MigrateCells(const MeshIO::MeshFileSlice& slice,
+                                           uint64_t first_cell_id,
+                                           const std::vector<int64_t>& cell_pids,
+                                           const std::map<uint64_t, Vector3>& vertices)
+{
+  const int num_locations = opensn::mpi_comm.size();
+  const size_t num_local_cells = slice.cells.size();
+
+  // Subscribe every cell, with its partition, to the home location of each of its vertices
+  std::map<int, std::vector<uint64_t>> subscriptions;
+  for (size_t c = 0; c < num_local_cells; ++c)
+    for (uint64_t vid : slice.cells[c]->vertex_ids)
+    {
+      auto& home_subscriptions = subscriptions[static_cast<int>(vid % num_locations)];
+      home_subscriptions.push_back(vid);
+      home_subscriptions.push_back(first_cell_id + c);
+      home_subscriptions.push_back(static_cast<uint64_t>(cell_pids[c]));
+    }
+  const auto recv_subscriptions = MapAllToAll(subscriptions);
+
+  // A cell is a ghost on the partitions of all cells sharing one of its vertices. The home
+  // location tells the source of each cell which partitions need it.
+  std::map<uint64_t, std::vector<std::array<uint64_t, 3>>> vertex_cells;
+  for (const auto& [pid, pid_subscriptions] : recv_subscriptions)
+    for (size_t i = 0; i < pid_subscriptions.size(); i += 3)
+      vertex_cells[pid_subscriptions[i]].push_back(
+        {pid_subscriptions[i + 1], pid_subscriptions[i + 2], static_cast<uint64_t>(pid)});
+
+  std::map<int, std::set<std::pair<uint64_t, uint64_t>>> ghost_destinations;
+  for (const auto& [vid, cells] : vertex_cells)
+    for (const auto& cell : cells)
+      for (const auto& other_cell : cells)
+        if (other_cell[1] != cell[1])
+          ghost_destinations[static_cast<int>(cell[2])].emplace(cell[0], other_cell[1]);
+
+  std::map<int, std::vector<uint64_t>> ghost_requests;
+  for (const auto& [pid, destinations] : ghost_destinations)
+    for (const auto& [cell_global_id, dest] : destinations)
+    {
+      ghost_requests[pid].push_back(cell_global_id);
+      ghost_requests[pid].push_back(dest);
+    }
+  const auto recv_ghost_requests = MapAllToAll(ghost_requests);
+
+  std::vector<std::set<int>> cell_destinations(num_local_cells);
+  for (size_t c = 0; c < num_local_cells; ++c)
+    cell_destinations[c].insert(static_cast<int>(cell_pids[c]));
+  for (const auto& [pid, pid_requests] : recv_ghost_requests)
+    for (size_t i = 0; i < pid_requests.size(); i += 2)
+      cell_destinations[pid_requests[i] - first_cell_id].insert(
+        static_cast<int>(pid_requests[i + 1]));
+
+  // Send the cells along with the coordinates of their vertices
+  std::map<int, ByteArray> serial_data;
+  for (size_t c = 0; c < num_local_cells; ++c)
+  {
+    const auto& cell = *slice.cells[c];
+    for (const int dest : cell_destinations[c])
+    {
+      auto& dest_data = serial_data[dest];
+      dest_data.Write(static_cast<int>(cell_pids[c]));
+      dest_data.Write(first_cell_id + c);
+      SerializeCell(dest_data, cell);
+      for (uint64_t vid : cell.vertex_ids)
+        dest_data.Write(vertices.at(vid));
+    }
+  }
+
+  std::map<int, std::vector<std::byte>> send_data;
+  for (auto& [pid, pid_data] : serial_data)
+    send_data[pid] = std::move(pid_data.Data());
+  const auto recv_data = MapAllToAll(send_data);
+
+  std::map<uint64_t, std::pair<int, std::shared_ptr<UnpartitionedMesh::LightWeightCell>>> cells;
+  std::map<uint64_t, Vector3> local_vertices;
+  for (const auto& [pid, pid_data] : recv_data)
+  {
+    ByteArray pid_serial_data(pid_data);
+    while (not pid_serial_data.EndOfBuffer())
+    {
+      const auto cell_pid = pid_serial_data.Read<int>();
+      const auto cell_global_id = pid_serial_data.Read<uint64_t>();
+      auto cell = DeserializeCell(pid_serial_data);
+      for (uint64_t vid : cell->vertex_ids)
+      {
+        auto& vertex = local_vertices[vid];
+        vertex.x = pid_serial_data.Read<double>();
+        vertex.y = pid_serial_data.Read<double>();
+        vertex.z = pid_serial_data.Read<double>();
+      }
+      cells[cell_global_id] = std::make_pair(cell_pid, std::move(cell));
+    }
+  }
+
+  // Set up the local mesh
+  auto grid_ptr = MeshContinuum::New();
+
+  grid_ptr->vertices.Reserve(local_vertices.size());
+  for (const auto& [vid, vertex] : local_vertices)
+    grid_ptr->vertices.Insert(vid, vertex);
+
+  for (const auto& [cell_global_id, pid_cell] : cells)
+  {
+    const auto& [cell_pid, raw_cell] = pid_cell;
+    grid_ptr->cells.push_back(
+      SetupCell(*raw_cell, cell_global_id, cell_pid, STLVertexListHelper(local_vertices)));
+  }
+
+  grid_ptr->SetDimension(slice.dimension);
+  grid_ptr->SetType(UNSTRUCTURED);
+  grid_ptr->SetGlobalVertexCount(slice.num_global_vertices);
+  ComputeAndPrintStats(*grid_ptr);
+
+  return grid_ptr;
+}
+
+void
+DistributedFileMeshGenerator::SerializeCell(ByteArray& serial_data,
+                                            const UnpartitionedMesh::LightWeightCell& cell)
+{
+  serial_data.Write(cell.type);
+  serial_data.Write(cell.sub_type);
+  serial_data.Write(cell.centroid.x);
+  serial_data.Write(cell.centroid.y);
+  serial_data.Write(cell.centroid.z);
+  serial_data.Write(cell.material_id);
+  serial_data.Write(cell.vertex_ids.size());
+  for (uint64_t vid : cell.vertex_ids)
+    serial_data.Write(vid);
+
+  serial_data.Write(cell.faces.size());
+  for (const auto& face : cell.faces)
+  {
+    serial_data.Write(face.vertex_ids.size());
+    for (uint64_t vid : face.vertex_ids)
+      serial_data.Write(vid);
+    serial_data.Write(face.has_neighbor);
+    serial_data.Write(face.neighbor);
+  }
+}
+
+std::shared_ptr<UnpartitionedMesh::LightWeightCell>
+DistributedFileMeshGenerator::DeserializeCell(ByteArray& serial_data)
+{
+  const auto type = serial_data.Read<CellType>();
+  const auto sub_type = serial_data.Read<CellType>();
+  auto cell = std::make_shared<UnpartitionedMesh::LightWeightCell>(type, sub_type);
+
+  cell->centroid.x = serial_data.Read<double>();
+  cell->centroid.y = serial_data.Read<double>();
+  cell->centroid.z = serial_data.Read<double>();
+  cell->material_id = serial_data.Read<int>();
+
+  const auto num_vids = serial_data.Read<size_t>();
+  for (size_t v = 0; v < num_vids; ++v)
+    cell->vertex_ids.push_back(serial_data.Read<uint64_t>());
+
+  const auto num_faces = serial_data.Read<size_t>();
+  for (size_t f = 0; f < num_faces; ++f)
+  {
+    UnpartitionedMesh::LightWeightFace face;
+    const auto num_face_vids = serial_data.Read<size_t>();
+    for (size_t v = 0; v < num_face_vids; ++v)
+      face.vertex_ids.push_back(serial_data.Read<uint64_t>());
+
+    face.has_neighbor = serial_data.Read<bool>();
+    face.neighbor = serial_data.Read<uint64_t>();
+
+    cell->faces.push_back(std::move(face));
+  }
+
+  return cell;
+}
+
+} // namespace opensn
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "framework/mesh/mesh_generator/mesh_generator.h"
+#include "framework/mesh/io/mesh_io.h"
+
+namespace opensn
+{
+class ByteArray;
+
+/**
+ * Reads and partitions a mesh file without ever holding the whole mesh on a single location.
+ * Every location reads an equal slice of the file, faces are matched to their neighbors through
+ * a distributed hash of their vertex ids, the cell graph is partitioned in parallel, and each cell
+ * is finally migrated to its owning location and to every location it is a ghost on.
+ *
+ * Only Gmsh format 2.2 files are supported. Other formats go through FromFileMeshGenerator,
+ * which reads the whole mesh on every location.
+ */
+class DistributedFileMeshGenerator : public MeshGenerator
+{
+public:
+  static InputParameters GetInputParameters();
+  explicit DistributedFileMeshGenerator(const InputParameters& params);
+
+  /// Reads, connects, partitions and distributes the mesh, then adds it to the mesh stack.
+  void Execute() override;
+
+private:
+  /**
+   * Moves the cells of all slices into contiguous blocks of equal size, keeping the file order of
+   * cells. Returns the global id of the first local cell.
+   */
+  static uint64_t BalanceCells(MeshIO::MeshFileSlice& slice);
+
+  /**
+   * Returns the coordinates of the vertices of the local cells. Vertices are routed through a
+   * home location, given by their id, from the location that read them to those that need them.
+   */
+  std::map<uint64_t, Vector3> FetchVertices(const MeshIO::MeshFileSlice& slice) const;
+
+  /**
+   * Connects the faces of the local cells to their neighbors and the boundary elements of all
+   * slices. Faces are matched on a home location given by a hash of their sorted vertex ids.
+   */
+  static void ConnectCells(MeshIO::MeshFileSlice& slice, uint64_t first_cell_id);
+
+  /**
+   * Sends every local cell, with its vertices, to its partition and to the partitions of all
+   * cells sharing a vertex with it, then builds the local mesh from the received cells.
+   */
+  static std::shared_ptr<MeshContinuum> MigrateCells(const MeshIO::MeshFileSlice& slice,
+                                                     uint64_t first_cell_id,
+                                                     const std::vector<int64_t>& cell_pids,
+                                                     const std::map<uint64_t, Vector3>& vertices);
+
+  static void SerializeCell(ByteArray& serial_data,
+                            const UnpartitionedMesh::LightWeightCell& cell);
+  static std::shared_ptr<UnpartitionedMesh::LightWeightCell>
+  DeserializeCell(ByteArray& serial_data);
+
+  const std::string filename_;
+};
+
+} // namespace opensn
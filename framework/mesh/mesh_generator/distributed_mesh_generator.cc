@@ -274,6 +274,7 @@ DistributedMeshGenerator::SetupLocalMesh(DistributedMeshData& mesh_info)
   grid_ptr->GetBoundaryIDMap() = mesh_info.boundary_id_map;
 
   auto& vertices = mesh_info.vertices;
+  grid_ptr->vertices.Reserve(vertices.size());
   for (const auto& [vid, vertex] : vertices)
     grid_ptr->vertices.Insert(vid, vertex);
 
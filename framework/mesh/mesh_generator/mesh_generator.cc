@@ -9,6 +9,8 @@
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
 #include "framework/mesh/cell/cell.h"
+#include <algorithm>
+#include <numeric>
 
 namespace opensn
 {
@@ -34,6 +36,23 @@ MeshGenerator::GetInputParameters()
     "Handle to a GraphPartitioner object to use for parallel partitioning."
     "This will default to PETScGraphPartitioner with a \"parmetis\" setting");
 
+  params.AddOptionalParameter(
+    "partition_weights",
+    "uniform",
+    "Weights handed to the partitioner. \"uniform\" balances cell counts. \"sweep_cost\" "
+    "weights each cell by its node count squared times its number of faces and each "
+    "cell-to-cell connection by the number of face nodes, approximating sweep work and "
+    "angular flux traffic.");
+
+  params.ConstrainParameterRange("partition_weights",
+                                 AllowableRangeList::New({"uniform", "sweep_cost"}));
+
+  params.AddOptionalParameterArray(
+    "cell_weights",
+    std::vector<double>{},
+    "Optional per-cell partitioning weights indexed by cell global id, e.g. measured per-cell "
+    "sweep times from a previous run. Overrides the cell weights of \"partition_weights\".");
+
   params.AddOptionalParameter(
     "replicated_mesh",
     false,
@@ -45,7 +64,9 @@ MeshGenerator::GetInputParameters()
 MeshGenerator::MeshGenerator(const InputParameters& params)
   : Object(params),
     scale_(params.GetParamValue<double>("scale")),
-    replicated_(params.GetParamValue<bool>("replicated_mesh"))
+    replicated_(params.GetParamValue<bool>("replicated_mesh")),
+    partition_weights_(params.GetParamValue<std::string>("partition_weights")),
+    cell_weights_(params.GetParamVectorValue<double>("cell_weights"))
 {
   // Convert input handles
   auto input_handles = params.GetParamVectorValue<size_t>("inputs");
@@ -194,13 +215,71 @@ MeshGenerator::PartitionMesh(const UnpartitionedMesh& input_umesh, int num_parti
   // Note A: We do not add the diagonal here. If we do, ParMETIS seems
   // to produce sub-optimal partitions
 
+  // Build weights
+  std::vector<double> cell_weights;
+  std::vector<std::vector<double>> edge_weights;
+  BuildPartitionWeights(raw_cells, 0, num_raw_cells, cell_weights, edge_weights);
+
   // Execute partitioner
   std::vector<int64_t> cell_pids =
-    partitioner_->Partition(cell_graph, cell_centroids, num_partitions);
+    partitioner_->Partition(cell_graph, cell_centroids, num_partitions, cell_weights, edge_weights);
+
+  // Report the weighted load balance
+  if (not cell_weights.empty())
+  {
+    std::vector<double> partition_weights(num_partitions, 0.0);
+    for (size_t c = 0; c < num_raw_cells; ++c)
+      partition_weights[cell_pids[c]] += cell_weights[c];
+
+    const double max_weight = *std::max_element(partition_weights.begin(), partition_weights.end());
+    const double avg_weight =
+      std::accumulate(partition_weights.begin(), partition_weights.end(), 0.0) / num_partitions;
+    if (avg_weight > 0.0)
+      log.Log0Verbose1() << "Partition weight imbalance (max/avg): " << max_weight / avg_weight;
+  }
 
   return cell_pids;
 }
 
+void
+MeshGenerator::BuildPartitionWeights(
+  const std::vector<std::shared_ptr<UnpartitionedMesh::LightWeightCell>>& cells,
+  uint64_t first_cell_id,
+  size_t num_global_cells,
+  std::vector<double>& cell_weights,
+  std::vector<std::vector<double>>& edge_weights) const
+{
+  const size_t num_cells = cells.size();
+  if (partition_weights_ == "sweep_cost")
+  {
+    cell_weights.reserve(num_cells);
+    edge_weights.reserve(num_cells);
+    for (const auto& raw_cell_ptr : cells)
+    {
+      const auto num_nodes = static_cast<double>(raw_cell_ptr->vertex_ids.size());
+      const auto num_faces = static_cast<double>(raw_cell_ptr->faces.size());
+      cell_weights.push_back(num_nodes * num_nodes * num_faces);
+
+      std::vector<double> cell_edge_weights;
+      for (auto& face : raw_cell_ptr->faces)
+        if (face.has_neighbor)
+          cell_edge_weights.push_back(static_cast<double>(face.vertex_ids.size()));
+      edge_weights.push_back(std::move(cell_edge_weights));
+    }
+  }
+
+  if (not cell_weights_.empty())
+  {
+    OpenSnInvalidArgumentIf(cell_weights_.size() != num_global_cells,
+                            "The number of entries in \"cell_weights\" (" +
+                              std::to_string(cell_weights_.size()) +
+                              ") does not match the number of cells (" +
+                              std::to_string(num_global_cells) + ").");
+    cell_weights.assign(cell_weights_.begin() + first_cell_id,
+                        cell_weights_.begin() + first_cell_id + num_cells);
+  }
+}
+
 std::shared_ptr<MeshContinuum>
 MeshGenerator::SetupMesh(std::shared_ptr<UnpartitionedMesh> input_umesh,
                          const std::vector<int64_t>& cell_pids)
@@ -68,6 +68,18 @@ protected:
    */
   std::vector<int64_t> PartitionMesh(const UnpartitionedMesh& input_umesh, int num_partitions);
 
+  /**
+   * Builds the partitioning weights of the cells with global ids `first_cell_id` and up, as
+   * selected by the "partition_weights" and "cell_weights" parameters. Weights are left empty
+   * when unit weights apply.
+   */
+  void BuildPartitionWeights(
+    const std::vector<std::shared_ptr<UnpartitionedMesh::LightWeightCell>>& cells,
+    uint64_t first_cell_id,
+    size_t num_global_cells,
+    std::vector<double>& cell_weights,
+    std::vector<std::vector<double>>& edge_weights) const;
+
   /// Executes the partitioner and configures the mesh as a real mesh.
   std::shared_ptr<MeshContinuum> SetupMesh(std::shared_ptr<UnpartitionedMesh> input_umesh,
                                            const std::vector<int64_t>& cell_pids);
@@ -93,6 +105,10 @@ protected:
 
   const double scale_;
   const bool replicated_;
+  /// Weighting model used when partitioning.
+  const std::string partition_weights_;
+  /// User supplied per-cell partitioning weights.
+  const std::vector<double> cell_weights_;
   std::vector<MeshGenerator*> inputs_;
   GraphPartitioner* partitioner_ = nullptr;
 };
@@ -398,6 +398,7 @@ SplitFileMeshGenerator::SetupLocalMesh(SplitMeshInfo& mesh_info)
   auto& cells = mesh_info.cells;
   auto& vertices = mesh_info.vertices;
 
+  grid_ptr->vertices.Reserve(vertices.size());
   for (const auto& [vid, vertex] : vertices)
     grid_ptr->vertices.Insert(vid, vertex);
 
@@ -8,10 +8,87 @@
 #include "framework/logging/log.h"
 #include "framework/utils/timer.h"
 #include <algorithm>
+#include <limits>
 
 namespace opensn
 {
 
+namespace
+{
+
+/**
+ * Open-addressing hash table of faces keyed by their sorted vertex ids. The table stores only
+ * the key hash and a caller defined entry id per slot. Callers resolve hash collisions by
+ * comparing the vertices of the face an entry refers to, which keeps the table at 16 bytes per
+ * slot and avoids storing keys.
+ */
+class FaceHashTable
+{
+public:
+  static constexpr uint64_t NOT_FOUND = std::numeric_limits<uint64_t>::max();
+
+  /// Creates a table able to hold `max_num_entries` entries at a load factor of at most 0.5.
+  explicit FaceHashTable(size_t max_num_entries)
+  {
+    size_t capacity = 16;
+    while (capacity < 2 * max_num_entries)
+      capacity *= 2;
+    slots_.assign(capacity, Slot{});
+    mask_ = capacity - 1;
+  }
+
+  /// Sorts a face's vertex ids into `key` and returns the hash of the sorted ids.
+  static uint64_t SortedKeyHash(const std::vector<uint64_t>& vertex_ids,
+                                std::vector<uint64_t>& key)
+  {
+    key.assign(vertex_ids.begin(), vertex_ids.end());
+    std::sort(key.begin(), key.end());
+
+    // FNV-1a over the ids followed by a splitmix64 finalizer to spread the low bits
+    uint64_t hash = 14695981039346656037ULL;
+    for (uint64_t vid : key)
+    {
+      hash ^= vid;
+      hash *= 1099511628211ULL;
+    }
+    hash ^= hash >> 30;
+    hash *= 0xbf58476d1ce4e5b9ULL;
+    hash ^= hash >> 27;
+    hash *= 0x94d049bb133111ebULL;
+    hash ^= hash >> 31;
+    return hash;
+  }
+
+  /// Returns the first entry, in insertion order, with the given hash that satisfies `matches`.
+  template <typename Predicate>
+  uint64_t Find(uint64_t hash, Predicate matches) const
+  {
+    for (size_t s = hash & mask_; slots_[s].entry != NOT_FOUND; s = (s + 1) & mask_)
+      if (slots_[s].hash == hash and matches(slots_[s].entry))
+        return slots_[s].entry;
+    return NOT_FOUND;
+  }
+
+  void Insert(uint64_t hash, uint64_t entry)
+  {
+    size_t s = hash & mask_;
+    while (slots_[s].entry != NOT_FOUND)
+      s = (s + 1) & mask_;
+    slots_[s] = {hash, entry};
+  }
+
+private:
+  struct Slot
+  {
+    uint64_t hash = 0;
+    uint64_t entry = NOT_FOUND;
+  };
+  std::vector<Slot> slots_;
+  size_t mask_ = 0;
+};
+
+} // namespace
+
 UnpartitionedMesh::UnpartitionedMesh() : dim_(0), mesh_type_(UNSTRUCTURED), extruded_(false)
 {
 }
@@ -204,11 +281,10 @@ UnpartitionedMesh::SetOrthoAttributes(size_t nx, size_t ny, size_t nz)
 void
 UnpartitionedMesh::BuildMeshConnectivity()
 {
-  const size_t num_raw_cells = raw_cells_.size();
   const size_t num_raw_vertices = vertices_.size();
 
   // Reset all cell neighbors
-  int num_bndry_faces = 0;
+  size_t num_bndry_faces = 0;
   for (auto& cell : raw_cells_)
     for (auto& face : cell->faces)
       if (not face.has_neighbor)
@@ -220,8 +296,8 @@ UnpartitionedMesh::BuildMeshConnectivity()
                      << num_bndry_faces;
 
   log.Log() << program_timer.GetTimeString() << " Establishing cell connectivity.";
+  Timer timer;
 
-  // Establish internal connectivity
   // Populate vertex subscriptions to internal cells
   vertex_cell_subscriptions_.resize(num_raw_vertices);
   {
@@ -234,122 +310,102 @@ UnpartitionedMesh::BuildMeshConnectivity()
     }
   }
 
+  const double subscriptions_time = timer.GetTime();
   log.Log() << program_timer.GetTimeString() << " Vertex cell subscriptions complete.";
 
-  // Process raw cells
+  // Establish internal connectivity. Every unconnected face looks up its sorted vertex ids in a
+  // table of the faces visited so far that are still unconnected. On a match the two faces are
+  // connected, otherwise the face is added to the table.
+  std::vector<uint64_t> key;
+  std::vector<uint64_t> other_key;
+  auto SameVertices = [&other_key](const std::vector<uint64_t>& vertex_ids,
+                                   const std::vector<uint64_t>& sorted_key)
+  {
+    if (vertex_ids.size() != sorted_key.size())
+      return false;
+    other_key.assign(vertex_ids.begin(), vertex_ids.end());
+    std::sort(other_key.begin(), other_key.end());
+    return other_key == sorted_key;
+  };
+
+  size_t num_internal_face_pairs = 0;
   {
-    uint64_t aux_counter = 0;
+    // Cell id and face index of each face in the table
+    std::vector<std::pair<uint64_t, unsigned int>> table_faces;
+    FaceHashTable table(num_bndry_faces);
+
     uint64_t cur_cell_id = 0;
     for (auto& cell : raw_cells_)
     {
-      for (auto& cur_cell_face : cell->faces)
+      for (unsigned int f = 0; f < cell->faces.size(); ++f)
       {
+        auto& cur_cell_face = cell->faces[f];
         if (cur_cell_face.has_neighbor)
           continue;
-        const std::set<uint64_t> cfvids(cur_cell_face.vertex_ids.begin(),
-                                        cur_cell_face.vertex_ids.end());
 
-        std::set<size_t> cells_to_search;
-        for (uint64_t vid : cfvids)
-          for (uint64_t cell_id : vertex_cell_subscriptions_.at(vid))
-            if (cell_id != cur_cell_id)
-              cells_to_search.insert(cell_id);
+        const uint64_t hash = FaceHashTable::SortedKeyHash(cur_cell_face.vertex_ids, key);
+        const uint64_t match = table.Find(
+          hash,
+          [&](uint64_t entry)
+          {
+            const auto& [adj_cell_id, adj_face_id] = table_faces[entry];
+            const auto& adj_cell_face = raw_cells_[adj_cell_id]->faces[adj_face_id];
+            return adj_cell_id != cur_cell_id and not adj_cell_face.has_neighbor and
+                   SameVertices(adj_cell_face.vertex_ids, key);
+          });
 
-        for (uint64_t adj_cell_id : cells_to_search)
+        if (match == FaceHashTable::NOT_FOUND)
         {
-          auto adj_cell = raw_cells_.at(adj_cell_id);
-
-          for (auto& adj_cell_face : adj_cell->faces)
-          {
-            if (adj_cell_face.has_neighbor)
-              continue;
-            const std::set<uint64_t> afvids(adj_cell_face.vertex_ids.begin(),
-                                            adj_cell_face.vertex_ids.end());
-
-            if (cfvids == afvids)
-            {
-              cur_cell_face.neighbor = adj_cell_id;
-              adj_cell_face.neighbor = cur_cell_id;
-
-              cur_cell_face.has_neighbor = true;
-              adj_cell_face.has_neighbor = true;
-
-              goto face_neighbor_found;
-            }
-          } // for adjacent cell face
+          table.Insert(hash, table_faces.size());
+          table_faces.emplace_back(cur_cell_id, f);
+          continue;
         }
-      face_neighbor_found:;
-      } // for face
 
+        const auto& [adj_cell_id, adj_face_id] = table_faces[match];
+        auto& adj_cell_face = raw_cells_[adj_cell_id]->faces[adj_face_id];
+
+        cur_cell_face.neighbor = adj_cell_id;
+        adj_cell_face.neighbor = cur_cell_id;
+
+        cur_cell_face.has_neighbor = true;
+        adj_cell_face.has_neighbor = true;
+        ++num_internal_face_pairs;
+      } // for face
       ++cur_cell_id;
-      const double fraction_complete =
-        static_cast<double>(cur_cell_id) / static_cast<double>(num_raw_cells);
-      if (fraction_complete >= static_cast<double>(aux_counter + 1) * 0.1)
-      {
-        log.Log() << program_timer.GetTimeString() << " Surpassing cell " << cur_cell_id << " of "
-                  << num_raw_cells << " (" << (aux_counter + 1) * 10 << "%)";
-        ++aux_counter;
-      }
     } // for cell
   }
 
+  const double internal_time = timer.GetTime();
   log.Log() << program_timer.GetTimeString() << " Establishing cell boundary connectivity.";
 
-  // Establish boundary connectivity
-  // Make list of internal cells on the boundary
-  std::vector<std::shared_ptr<LightWeightCell>> internal_cells_on_boundary;
-  for (auto& cell : raw_cells_)
+  // Establish boundary connectivity. Unconnected faces take the id of the first boundary cell
+  // with the same vertices.
+  size_t num_boundary_matches = 0;
   {
-    bool cell_on_boundary = false;
-    for (auto& face : cell->faces)
-      if (not face.has_neighbor)
-      {
-        cell_on_boundary = true;
-        break;
-      }
-
-    if (cell_on_boundary)
-      internal_cells_on_boundary.push_back(cell);
-  }
+    FaceHashTable table(raw_boundary_cells_.size());
+    for (uint64_t bndry_cell_id = 0; bndry_cell_id < raw_boundary_cells_.size(); ++bndry_cell_id)
+      table.Insert(
+        FaceHashTable::SortedKeyHash(raw_boundary_cells_[bndry_cell_id]->vertex_ids, key),
+        bndry_cell_id);
 
-  // Populate vertex subscriptions to boundary cells
-  std::vector<std::set<uint64_t>> vertex_bndry_cell_subscriptions(vertices_.size());
-  {
-    uint64_t cur_cell_id = 0;
-    for (auto& cell : raw_boundary_cells_)
-    {
-      for (auto vid : cell->vertex_ids)
-        vertex_bndry_cell_subscriptions.at(vid).insert(cur_cell_id);
-      ++cur_cell_id;
-    }
-  }
-
-  // Process boundary cells
-  for (auto& cell : internal_cells_on_boundary)
-    for (auto& face : cell->faces)
-    {
-      if (face.has_neighbor)
-        continue;
-      std::set<uint64_t> cfvids(face.vertex_ids.begin(), face.vertex_ids.end());
-
-      std::set<size_t> cells_to_search;
-      for (uint64_t vid : face.vertex_ids)
-        for (uint64_t cell_id : vertex_bndry_cell_subscriptions[vid])
-          cells_to_search.insert(cell_id);
-
-      for (uint64_t adj_cell_id : cells_to_search)
+    for (auto& cell : raw_cells_)
+      for (auto& face : cell->faces)
       {
-        auto& adj_cell = raw_boundary_cells_[adj_cell_id];
-
-        std::set<uint64_t> afvids(adj_cell->vertex_ids.begin(), adj_cell->vertex_ids.end());
+        if (face.has_neighbor)
+          continue;
 
-        if (cfvids == afvids)
+        const uint64_t hash = FaceHashTable::SortedKeyHash(face.vertex_ids, key);
+        const uint64_t match =
+          table.Find(hash,
+                     [&](uint64_t entry)
+                     { return SameVertices(raw_boundary_cells_[entry]->vertex_ids, key); });
+        if (match != FaceHashTable::NOT_FOUND)
         {
-          face.neighbor = adj_cell->material_id;
-          break;
+          face.neighbor = raw_boundary_cells_[match]->material_id;
+          ++num_boundary_matches;
         }
-      } // for adj_cell_id
-    }   // for face
+      } // for face
+  }
 
   num_bndry_faces = 0;
   for (auto cell : raw_cells_)
@@ -362,7 +418,16 @@ UnpartitionedMesh::BuildMeshConnectivity()
                         "after connectivity: "
                      << num_bndry_faces;
 
-  log.Log() << program_timer.GetTimeString() << " Done establishing cell connectivity.";
+  const double total_time = timer.GetTime();
+  log.Log() << program_timer.GetTimeString() << " Done establishing cell connectivity.\n"
+            << "  Cells                   : " << raw_cells_.size() << "\n"
+            << "  Internal face pairs     : " << num_internal_face_pairs << "\n"
+            << "  Boundary faces matched  : " << num_boundary_matches << " of "
+            << num_bndry_faces << "\n"
+            << "  Vertex subscriptions (s): " << subscriptions_time / 1000.0 << "\n"
+            << "  Internal faces (s)      : " << (internal_time - subscriptions_time) / 1000.0
+            << "\n"
+            << "  Boundary faces (s)      : " << (total_time - internal_time) / 1000.0;
 }
 
 void
@@ -67,6 +67,25 @@ VectorListHas(const std::vector<T>& list, const B& val)
   return std::find(list.begin(), list.end(), val) != list.end();
 }
 
+/// Returns the number of bytes reserved by the elements of a vector.
+template <typename T>
+size_t
+VectorMemoryUsage(const std::vector<T>& list)
+{
+  return list.capacity() * sizeof(T);
+}
+
+/// Returns the number of bytes reserved by the elements of a nested vector, at all levels.
+template <typename T>
+size_t
+VectorMemoryUsage(const std::vector<std::vector<T>>& list)
+{
+  size_t bytes = list.capacity() * sizeof(std::vector<T>);
+  for (const auto& sub_list : list)
+    bytes += VectorMemoryUsage(sub_list);
+  return bytes;
+}
+
 struct SubSetInfo
 {
   size_t ss_begin;
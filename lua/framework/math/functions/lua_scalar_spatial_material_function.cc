@@ -19,12 +19,18 @@ LuaScalarSpatialMaterialFunction::GetInputParameters()
 {
   InputParameters params = ScalarSpatialMaterialFunction::GetInputParameters();
   params.AddRequiredParameter<std::string>("lua_function_name", "Name of the lua function");
+  params.AddOptionalParameter(
+    "lua_batch_function_name",
+    "",
+    "Name of a lua function that evaluates the function at an array of points of one material "
+    "in a single call, returning one value per point.");
   return params;
 }
 
 LuaScalarSpatialMaterialFunction::LuaScalarSpatialMaterialFunction(const InputParameters& params)
   : ScalarSpatialMaterialFunction(params),
-    lua_function_name_(params.GetParamValue<std::string>("lua_function_name"))
+    lua_function_name_(params.GetParamValue<std::string>("lua_function_name")),
+    lua_batch_function_name_(params.GetParamValue<std::string>("lua_batch_function_name"))
 {
 }
 
@@ -35,4 +41,22 @@ LuaScalarSpatialMaterialFunction::Evaluate(int mat_id, const opensn::Vector3& xy
   return LuaCall<double>(L, lua_function_name_, mat_id, xyz);
 }
 
+std::vector<double>
+LuaScalarSpatialMaterialFunction::EvaluateBatch(int mat_id,
+                                                const std::vector<opensn::Vector3>& xyz) const
+{
+  if (lua_batch_function_name_.empty())
+    return ScalarSpatialMaterialFunction::EvaluateBatch(mat_id, xyz);
+
+  lua_State* L = console.GetConsoleState();
+  auto lua_return = LuaCall<std::vector<double>>(L, lua_batch_function_name_, mat_id, xyz);
+
+  OpenSnLogicalErrorIf(lua_return.size() != xyz.size(),
+                       "Call to lua function " + lua_batch_function_name_ +
+                         " returned a vector of size " + std::to_string(lua_return.size()) +
+                         ", which is not the number of points " + std::to_string(xyz.size()) +
+                         ".");
+  return lua_return;
+}
+
 } // namespace opensnlua
@@ -14,9 +14,12 @@ public:
   static opensn::InputParameters GetInputParameters();
   explicit LuaScalarSpatialMaterialFunction(const opensn::InputParameters& params);
   double Evaluate(int mat_id, const opensn::Vector3& xyz) const override;
+  std::vector<double> EvaluateBatch(int mat_id,
+                                    const std::vector<opensn::Vector3>& xyz) const override;
 
 private:
   const std::string lua_function_name_;
+  const std::string lua_batch_function_name_;
 };
 
 } // namespace opensnlua
@@ -19,12 +19,18 @@ LuaVectorSpatialFunction::GetInputParameters()
 {
   InputParameters params = VectorSpatialFunction::GetInputParameters();
   params.AddRequiredParameter<std::string>("lua_function_name", "Name of the lua function");
+  params.AddOptionalParameter(
+    "lua_batch_function_name",
+    "",
+    "Name of a lua function that evaluates the function at an array of points in a single "
+    "call, returning the values of all points in one flat array.");
   return params;
 }
 
 LuaVectorSpatialFunction::LuaVectorSpatialFunction(const opensn::InputParameters& params)
   : opensn::VectorSpatialFunction(params),
-    lua_function_name_(params.GetParamValue<std::string>("lua_function_name"))
+    lua_function_name_(params.GetParamValue<std::string>("lua_function_name")),
+    lua_batch_function_name_(params.GetParamValue<std::string>("lua_batch_function_name"))
 {
 }
 
@@ -44,4 +50,22 @@ LuaVectorSpatialFunction::Evaluate(const opensn::Vector3& xyz, int num_component
   return lua_return;
 }
 
+std::vector<double>
+LuaVectorSpatialFunction::EvaluateBatch(const std::vector<opensn::Vector3>& xyz,
+                                        int num_components) const
+{
+  if (lua_batch_function_name_.empty())
+    return VectorSpatialFunction::EvaluateBatch(xyz, num_components);
+
+  lua_State* L = console.GetConsoleState();
+  auto lua_return = LuaCall<std::vector<double>>(L, lua_batch_function_name_, xyz);
+
+  OpenSnLogicalErrorIf(lua_return.size() != xyz.size() * num_components,
+                       "Call to lua function " + lua_batch_function_name_ +
+                         " returned a vector of size " + std::to_string(lua_return.size()) +
+                         ", which is not the number of points times the number of groups " +
+                         std::to_string(xyz.size() * num_components) + ".");
+  return lua_return;
+}
+
 } // namespace opensnlua
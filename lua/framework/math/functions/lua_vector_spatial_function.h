@@ -17,8 +17,12 @@ public:
 
   std::vector<double> Evaluate(const opensn::Vector3& xyz, int num_components) const override;
 
+  std::vector<double> EvaluateBatch(const std::vector<opensn::Vector3>& xyz,
+                                    int num_components) const override;
+
 private:
   const std::string lua_function_name_;
+  const std::string lua_batch_function_name_;
 };
 
 } // namespace opensnlua
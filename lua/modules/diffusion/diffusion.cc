@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
 // SPDX-License-Identifier: MIT
 
+#include "lua/framework/lua.h"
 #include "lua/framework/console/console.h"
 #include "lua/framework/math/functions/lua_scalar_spatial_material_function.h"
 #include "framework/parameters/input_parameters.h"
@@ -17,11 +18,28 @@ namespace opensnlua
 namespace
 {
 
+/// Returns whether the console defines a global lua function with the given name.
+bool
+LuaFunctionExists(const std::string& function_name)
+{
+  lua_State* L = console.GetConsoleState();
+  lua_getglobal(L, function_name.c_str());
+  const bool exists = lua_isfunction(L, -1);
+  lua_pop(L, 1);
+  return exists;
+}
+
+/**
+ * Creates the function calling the lua function with the given name. If a function with the same
+ * name suffixed by "_batch" exists, it is used to evaluate all quadrature points of a cell at once.
+ */
 std::shared_ptr<LuaScalarSpatialMaterialFunction>
 CreateFunction(const std::string& function_name)
 {
   opensn::ParameterBlock blk;
   blk.AddParameter("lua_function_name", function_name);
+  if (LuaFunctionExists(function_name + "_batch"))
+    blk.AddParameter("lua_batch_function_name", function_name + "_batch");
   opensn::InputParameters params = LuaScalarSpatialMaterialFunction::GetInputParameters();
   params.AssignParameters(blk);
   return std::make_shared<LuaScalarSpatialMaterialFunction>(params);
@@ -303,6 +303,12 @@ CFEMDiffusionSolver::Execute()
     DenseMatrix<double> Acell(num_nodes, num_nodes, 0.0);
     Vector<double> cell_rhs(num_nodes, 0.0);
 
+    // Evaluate the coefficients at the quadrature points
+    const auto& qpoints_xyz = fe_vol_data.QPointsXYZ();
+    const auto d_coef_qp = d_coef_function_->EvaluateBatch(imat, qpoints_xyz);
+    const auto sigma_a_qp = sigma_a_function_->EvaluateBatch(imat, qpoints_xyz);
+    const auto q_ext_qp = q_ext_function_->EvaluateBatch(imat, qpoints_xyz);
+
     for (size_t i = 0; i < num_nodes; ++i)
     {
       for (size_t j = 0; j < num_nodes; ++j)
@@ -310,17 +316,16 @@ CFEMDiffusionSolver::Execute()
         double entry_aij = 0.0;
         for (size_t qp : fe_vol_data.QuadraturePointIndices())
         {
-          entry_aij += (d_coef_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
+          entry_aij += (d_coef_qp[qp] *
                           fe_vol_data.ShapeGrad(i, qp).Dot(fe_vol_data.ShapeGrad(j, qp)) +
-                        sigma_a_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                          fe_vol_data.ShapeValue(i, qp) * fe_vol_data.ShapeValue(j, qp)) *
+                        sigma_a_qp[qp] * fe_vol_data.ShapeValue(i, qp) *
+                          fe_vol_data.ShapeValue(j, qp)) *
                        fe_vol_data.JxW(qp);
         } // for qp
         Acell(i, j) = entry_aij;
       } // for j
       for (size_t qp : fe_vol_data.QuadraturePointIndices())
-        cell_rhs(i) += q_ext_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                       fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
+        cell_rhs(i) += q_ext_qp[qp] * fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
     } // for i
 
     // Flag nodes for being on a boundary
@@ -303,6 +303,12 @@ DFEMDiffusionSolver::Execute()
 
     const auto imat = cell.material_id;
 
+    // Evaluate the coefficients at the quadrature points
+    const auto& qpoints_xyz = fe_vol_data.QPointsXYZ();
+    const auto d_coef_qp = d_coef_function_->EvaluateBatch(imat, qpoints_xyz);
+    const auto sigma_a_qp = sigma_a_function_->EvaluateBatch(imat, qpoints_xyz);
+    const auto q_ext_qp = q_ext_function_->EvaluateBatch(imat, qpoints_xyz);
+
     // Assemble volumetric terms
     for (size_t i = 0; i < num_nodes; ++i)
     {
@@ -314,18 +320,17 @@ DFEMDiffusionSolver::Execute()
         double entry_aij = 0.0;
         for (size_t qp : fe_vol_data.QuadraturePointIndices())
         {
-          entry_aij += (d_coef_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
+          entry_aij += (d_coef_qp[qp] *
                           fe_vol_data.ShapeGrad(i, qp).Dot(fe_vol_data.ShapeGrad(j, qp)) +
-                        sigma_a_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                          fe_vol_data.ShapeValue(i, qp) * fe_vol_data.ShapeValue(j, qp)) *
+                        sigma_a_qp[qp] * fe_vol_data.ShapeValue(i, qp) *
+                          fe_vol_data.ShapeValue(j, qp)) *
                        fe_vol_data.JxW(qp);
         } // for qp
         MatSetValue(A_, imap, jmap, entry_aij, ADD_VALUES);
       } // for j
       double entry_rhs_i = 0.0;
       for (size_t qp : fe_vol_data.QuadraturePointIndices())
-        entry_rhs_i += q_ext_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                       fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
+        entry_rhs_i += q_ext_qp[qp] * fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
       VecSetValue(b_, imap, entry_rhs_i, ADD_VALUES);
     } // for i
 
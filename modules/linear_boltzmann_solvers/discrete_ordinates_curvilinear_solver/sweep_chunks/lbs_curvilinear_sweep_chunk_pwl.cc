@@ -13,7 +13,7 @@ namespace opensn
 
 SweepChunkPwlrz::SweepChunkPwlrz(const MeshContinuum& grid,
                                  const SpatialDiscretization& discretization_primary,
-                                 const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                                 const UnitCellMatricesPool& unit_cell_matrices,
                                  const std::vector<UnitCellMatrices>& secondary_unit_cell_matrices,
                                  std::vector<CellLBSView>& cell_transport_views,
                                  const std::vector<double>& densities,
@@ -188,11 +188,17 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
             const double mu_Nij = -face_mu_values[f] * M_surf[f](i, j);
             Amat(i, j) += mu_Nij;
 
-            const double* psi;
-            if (is_local_face)
-              psi = fluds.UpwindPsi(spls_index, in_face_counter, fj, 0, as_ss_idx);
-            else if (not is_boundary_face)
-              psi = fluds.NLUpwindPsi(preloc_face_counter, fj, 0, as_ss_idx);
+            // Upwind psi held by the FLUDS is read in storage precision
+            const double* psi = nullptr;
+            if (not is_boundary_face)
+            {
+              const PsiStorage* upwind_psi =
+                is_local_face ? fluds.UpwindPsi(spls_index, in_face_counter, fj, 0, as_ss_idx)
+                              : fluds.NLUpwindPsi(preloc_face_counter, fj, 0, as_ss_idx);
+              for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+                b[gsg](i) += upwind_psi[gsg] * mu_Nij;
+              continue;
+            }
             else
             {
               //  Determine whether incoming direction is incident on the point
@@ -336,19 +342,18 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
                 f, gs_gi + gsg, wt * face_mu_values[f] * b[gsg](i) * IntF_shapeI(i));
           }
 
-          double* psi = nullptr;
-          if (is_local_face)
-            psi = fluds.OutgoingPsi(spls_index, out_face_counter, fi, as_ss_idx);
-          else if (not is_boundary_face)
-            psi = fluds.NLOutgoingPsi(deploc_face_counter, fi, as_ss_idx);
+          if (not is_boundary_face)
+          {
+            PsiStorage* psi = is_local_face
+                                ? fluds.OutgoingPsi(spls_index, out_face_counter, fi, as_ss_idx)
+                                : fluds.NLOutgoingPsi(deploc_face_counter, fi, as_ss_idx);
+            for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+              psi[gsg] = static_cast<PsiStorage>(b[gsg](i));
+          }
           else if (is_reflecting_boundary_face)
-            psi = angle_set.PsiReflected(
-              face.neighbor_id, direction_num, cell_local_id, f, fi, gs_ss_begin);
-          else
-            continue;
-
-          if (not is_boundary_face or is_reflecting_boundary_face)
           {
+            double* psi = angle_set.PsiReflected(
+              face.neighbor_id, direction_num, cell_local_id, f, fi, gs_ss_begin);
             for (int gsg = 0; gsg < gs_ss_size; ++gsg)
               psi[gsg] = b[gsg](i);
           }
@@ -16,7 +16,7 @@ class SweepChunkPwlrz : public SweepChunk
 public:
   SweepChunkPwlrz(const MeshContinuum& grid,
                   const SpatialDiscretization& discretization_primary,
-                  const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                  const UnitCellMatricesPool& unit_cell_matrices,
                   const std::vector<UnitCellMatrices>& secondary_unit_cell_matrices,
                   std::vector<CellLBSView>& cell_transport_views,
                   const std::vector<double>& densities,
@@ -27,9 +27,15 @@ SweepWGSContext::SweepWGSContext(DiscreteOrdinatesSolver& lbs_solver,
     sweep_scheduler(lbs_solver.SweepType() == "AAH" ? SchedulingAlgorithm::DEPTH_OF_GRAPH
                                                     : SchedulingAlgorithm::FIRST_IN_FIRST_OUT,
                     *groupset.angle_agg,
-                    *sweep_chunk),
+                    *sweep_chunk,
+                    lbs_solver.NumSweepThreads()),
     lbs_ss_solver(lbs_solver)
 {
+  if (not lbs_solver.SweepTraceFile().empty())
+  {
+    const auto file_base = lbs_solver.SweepTraceFile() + "_gs" + std::to_string(groupset.id);
+    sweep_scheduler.EnableTracing(file_base, lbs_solver.SweepTraceBufferSize());
+  }
 }
 
 void
@@ -96,6 +102,15 @@ SweepWGSContext::SystemSize()
               << "%)";
   }
 
+#ifdef OPENSN_WITH_FLOAT_PSI
+  // Lagged fluxes of cyclic dependencies are single precision, which floors the residual
+  if (num_delayed_psi_globl > 0 and groupset.residual_tolerance < 1.0e-6)
+    log.Log0Warning() << "Groupset " << groupset.id
+                      << ": lagged angular unknowns may be stored in single precision, so the "
+                      << "residual tolerance " << groupset.residual_tolerance
+                      << " may not be reached.";
+#endif
+
   return {static_cast<int64_t>(local_size), static_cast<int64_t>(globl_size)};
 }
 
@@ -160,6 +175,9 @@ SweepWGSContext::PostSolveCallback()
                    static_cast<double>(num_unknowns)
               << "\n       Number of unknowns per sweep:  " << num_unknowns << "\n\n";
   }
+
+  if (const auto tracer = sweep_scheduler.Tracer())
+    tracer->LogSummary("Groupset " + std::to_string(groupset.id));
 }
 
 } // namespace opensn
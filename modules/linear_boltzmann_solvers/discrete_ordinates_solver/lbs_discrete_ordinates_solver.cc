@@ -26,6 +26,7 @@
 #include "framework/runtime.h"
 #include "caliper/cali.h"
 #include <iomanip>
+#include <set>
 
 namespace opensn
 {
@@ -56,13 +57,73 @@ DiscreteOrdinatesSolver::GetInputParameters()
 
   params.ConstrainParameterRange("sweep_type", AllowableRangeList::New({"AAH", "CBC"}));
 
+  params.AddOptionalParameter("num_sweep_threads",
+                              1,
+                              "Number of worker threads per MPI rank used to execute ready "
+                              "anglesets concurrently. Only used by AAH sweeps.");
+
+  params.ConstrainParameterRange("num_sweep_threads", AllowableRangeLowLimit::New(1));
+
+  params.AddOptionalParameter("pack_sweep_matrices",
+                              false,
+                              "If true, the cell matrices used by AAH sweeps are packed into "
+                              "contiguous arenas laid out in sweep order, one per sweep ordering. "
+                              "Trades memory for streaming access during sweeps.");
+
+  params.AddOptionalParameter("sweep_angle_block_size",
+                              1,
+                              "Number of angles of an angleset processed together per cell visit "
+                              "by AAH sweeps. Larger blocks amortize source gathers and batch the "
+                              "cell solves across angles and groups.");
+
+  params.ConstrainParameterRange("sweep_angle_block_size", AllowableRangeLowLimit::New(1));
+
+  params.AddOptionalParameter("distributed_sweep_setup",
+                              false,
+                              "If true, the location graphs of AAH sweeps are levelized with "
+                              "neighbor-to-neighbor communication only, instead of gathering the "
+                              "dependencies of all locations on every location. Location cycles "
+                              "are then broken by delaying edges that point upstream along the "
+                              "sweep direction rather than by a global feedback arc set.");
+
+  params.AddOptionalParameter("sweep_trace_file",
+                              "",
+                              "If not empty, the timeline of every sweep (waits for upstream data, "
+                              "executions and sends of each angleset, and delayed data receives) "
+                              "is traced. Each location writes a Chrome trace to "
+                              "<sweep_trace_file>_gs<groupset id>.<location id>.json when the "
+                              "solver is destroyed, and the parallel efficiency of the sweeps is "
+                              "logged after each groupset solve. The directory of the file must "
+                              "exist.");
+
+  params.AddOptionalParameter("sweep_trace_buffer_size",
+                              1048576,
+                              "Maximum number of sweep trace events kept per groupset and "
+                              "location. Older events are discarded first.");
+
+  params.ConstrainParameterRange("sweep_trace_buffer_size", AllowableRangeLowLimit::New(1));
+
+  params.AddOptionalParameter("cbc_prioritize_remote_successors",
+                              true,
+                              "If true, CBC sweeps execute ready cells that feed other locations "
+                              "before other ready cells so that downstream locations receive "
+                              "work sooner.");
+
   return params;
 }
 
 DiscreteOrdinatesSolver::DiscreteOrdinatesSolver(const InputParameters& params)
   : LBSSolver(params),
     verbose_sweep_angles_(params.GetParamVectorValue<size_t>("directions_sweep_order_to_print")),
-    sweep_type_(params.GetParamValue<std::string>("sweep_type"))
+    sweep_type_(params.GetParamValue<std::string>("sweep_type")),
+    num_sweep_threads_(params.GetParamValue<int>("num_sweep_threads")),
+    pack_sweep_matrices_(params.GetParamValue<bool>("pack_sweep_matrices")),
+    sweep_angle_block_size_(params.GetParamValue<int>("sweep_angle_block_size")),
+    cbc_prioritize_remote_successors_(
+      params.GetParamValue<bool>("cbc_prioritize_remote_successors")),
+    distributed_sweep_setup_(params.GetParamValue<bool>("distributed_sweep_setup")),
+    sweep_trace_file_(params.GetParamValue<std::string>("sweep_trace_file")),
+    sweep_trace_buffer_size_(params.GetParamValue<int>("sweep_trace_buffer_size"))
 {
 }
 
@@ -941,7 +1002,14 @@ DiscreteOrdinatesSolver::InitializeSweepDataStructures()
       quadrature_allow_cycles_map_[groupset.quadrature] = groupset.allow_cycles;
   }
 
-  // Build sweep orderings
+  // Find the sweep-ordering groups that induce identical sweep graphs
+  std::map<std::shared_ptr<AngularQuadrature>, std::vector<size_t>> quadrature_so_equivalence_map;
+  for (const auto& [quadrature, info] : quadrature_unq_so_grouping_map_)
+    quadrature_so_equivalence_map[quadrature] =
+      FindEquivalentSweepOrderings(*grid_ptr_, *quadrature, info.first);
+
+  // Build sweep orderings. Only the first group of each set of equivalent groups gets a SPDS, the
+  // others share it.
   quadrature_spds_map_.clear();
   if (sweep_type_ == "AAH")
   {
@@ -955,8 +1023,11 @@ DiscreteOrdinatesSolver::InitializeSweepDataStructures()
 
     // Initalize SPDS. All ranks initialize a SPDS for each angleset.
     log.Log0Verbose1() << program_timer.GetTimeString() << " Initializing AAH SPDS.";
+    std::vector<std::shared_ptr<AAH_SPDS>> unique_spds_list;
     for (const auto& [quadrature, info] : quadrature_unq_so_grouping_map_)
     {
+      const auto& equivalent_so = quadrature_so_equivalence_map[quadrature];
+      auto& spds_list = quadrature_spds_map_[quadrature];
       int id = 0;
       const auto& unique_so_groupings = info.first;
       for (const auto& so_grouping : unique_so_groupings)
@@ -964,109 +1035,46 @@ DiscreteOrdinatesSolver::InitializeSweepDataStructures()
         if (so_grouping.empty())
           continue;
 
+        if (equivalent_so[id] != static_cast<size_t>(id))
+        {
+          spds_list.push_back(spds_list[equivalent_so[id]]);
+          ++id;
+          continue;
+        }
+
         const size_t master_dir_id = so_grouping.front();
         const auto& omega = quadrature->omegas[master_dir_id];
+        const bool allow_cycles = quadrature_allow_cycles_map_[quadrature];
         const auto new_swp_order = std::make_shared<AAH_SPDS>(
-          id, omega, *this->grid_ptr_, quadrature_allow_cycles_map_[quadrature]);
-        quadrature_spds_map_[quadrature].push_back(new_swp_order);
+          id, omega, *this->grid_ptr_, allow_cycles, not distributed_sweep_setup_);
+        spds_list.push_back(new_swp_order);
+        unique_spds_list.push_back(new_swp_order);
         ++id;
       }
     }
 
-    // Generate the global sweep FAS for each SPDS. This is an expensive operation. It is
-    // distributed via MPI so that multiple MPI ranks can compute the FAS for one or more SPDS
-    // independently.
-    log.Log0Verbose1() << program_timer.GetTimeString() << " Build global sweep FAS for each SPDS.";
-    for (const auto& quadrature : quadrature_spds_map_)
-    {
-      for (const auto& spds : quadrature.second)
-      {
-        auto aah_spds = std::static_pointer_cast<AAH_SPDS>(spds);
-        auto id = aah_spds->Id();
-        if (opensn::mpi_comm.rank() == (id % opensn::mpi_comm.size()))
-          aah_spds->BuildGlobalSweepFAS();
-      }
-    }
-
-    // Communicate the FAS for each SPDS to all ranks.
-    log.Log0Verbose1() << program_timer.GetTimeString() << " Gather FAS for each SPDS.";
-    std::vector<int> local_edges_to_remove;
-    for (const auto& quadrature : quadrature_spds_map_)
-    {
-      for (const auto& spds : quadrature.second)
-      {
-        auto aah_spds = std::static_pointer_cast<AAH_SPDS>(spds);
-        auto id = aah_spds->Id();
-        if ((id % opensn::mpi_comm.size()) == opensn::mpi_comm.rank())
-        {
-          auto edges_to_remove = aah_spds->GlobalSweepFAS();
-          local_edges_to_remove.push_back(id);
-          local_edges_to_remove.push_back(static_cast<int>(edges_to_remove.size()));
-          local_edges_to_remove.insert(
-            local_edges_to_remove.end(), edges_to_remove.begin(), edges_to_remove.end());
-        }
-      }
-    }
-
-    int local_size = static_cast<int>(local_edges_to_remove.size());
-    std::vector<int> receive_counts(opensn::mpi_comm.size(), 0);
-    std::vector<int> displacements(opensn::mpi_comm.size(), 0);
-    mpi_comm.all_gather(local_size, receive_counts);
-
-    int total_size = 0;
-    for (auto i = 0; i < receive_counts.size(); ++i)
-    {
-      displacements[i] = total_size;
-      total_size += receive_counts[i];
-    }
-
-    std::vector<int> global_edges_to_remove(total_size, 0);
-    mpi_comm.all_gather(
-      local_edges_to_remove, global_edges_to_remove, receive_counts, displacements);
-
-    // Unpack the gathered data and update SPDS on all ranks.
-    int offset = 0;
-    while (offset < global_edges_to_remove.size())
+    if (distributed_sweep_setup_)
     {
-      int spds_id = global_edges_to_remove[offset++];
-      int num_edges = global_edges_to_remove[offset++];
-      std::vector<int> edges;
-      for (auto i = 0; i < num_edges; ++i)
-        edges.emplace_back(global_edges_to_remove[offset++]);
-
-      for (const auto& quadrature : quadrature_spds_map_)
-      {
-        for (const auto& spds : quadrature.second)
-        {
-          auto aah_spds = std::static_pointer_cast<AAH_SPDS>(spds);
-          if (aah_spds->Id() == spds_id)
-          {
-            aah_spds->SetGlobalSweepFAS(edges);
-            break;
-          }
-        }
-      }
+      // Levelize all sweep graphs together with neighbor communication only.
+      log.Log0Verbose1() << program_timer.GetTimeString()
+                         << " Build distributed sweep TDGs for each SPDS.";
+      std::vector<AAH_SPDS*> aah_spds_list;
+      for (const auto& spds : unique_spds_list)
+        aah_spds_list.push_back(spds.get());
+      AAH_SPDS::BuildDistributedSweepTDGs(aah_spds_list);
     }
-
-    // Build TDG for each SPDS on all ranks.
-    log.Log0Verbose1() << program_timer.GetTimeString() << " Build global sweep TDGs.";
-    for (const auto& quadrature : quadrature_spds_map_)
-      for (const auto& spds : quadrature.second)
-        std::static_pointer_cast<AAH_SPDS>(spds)->BuildGlobalSweepTDG();
+    else
+      BuildGlobalSweepTDGs(unique_spds_list);
 
     // Print ghosted sweep graph if requested
     if (not verbose_sweep_angles_.empty())
     {
-      for (const auto& quadrature : quadrature_spds_map_)
+      for (const auto& spds : unique_spds_list)
       {
-        for (const auto& spds : quadrature.second)
+        for (const size_t dir_id : verbose_sweep_angles_)
         {
-          for (const size_t dir_id : verbose_sweep_angles_)
-          {
-            auto aah_spds = std::static_pointer_cast<AAH_SPDS>(spds);
-            if (aah_spds->Id() == dir_id)
-              aah_spds->PrintGhostedGraph();
-          }
+          if (spds->Id() == dir_id)
+            spds->PrintGhostedGraph();
         }
       }
     }
@@ -1076,17 +1084,26 @@ DiscreteOrdinatesSolver::InitializeSweepDataStructures()
     // Build SPDS
     for (const auto& [quadrature, info] : quadrature_unq_so_grouping_map_)
     {
+      const auto& equivalent_so = quadrature_so_equivalence_map[quadrature];
+      auto& spds_list = quadrature_spds_map_[quadrature];
       const auto& unique_so_groupings = info.first;
       for (const auto& so_grouping : unique_so_groupings)
       {
         if (so_grouping.empty())
           continue;
 
+        const size_t so_id = spds_list.size();
+        if (equivalent_so[so_id] != so_id)
+        {
+          spds_list.push_back(spds_list[equivalent_so[so_id]]);
+          continue;
+        }
+
         const size_t master_dir_id = so_grouping.front();
         const auto& omega = quadrature->omegas[master_dir_id];
         const auto new_swp_order = std::make_shared<CBC_SPDS>(
           omega, *this->grid_ptr_, quadrature_allow_cycles_map_[quadrature]);
-        quadrature_spds_map_[quadrature].push_back(new_swp_order);
+        spds_list.push_back(new_swp_order);
       }
     }
   }
@@ -1095,35 +1112,129 @@ DiscreteOrdinatesSolver::InitializeSweepDataStructures()
 
   opensn::mpi_comm.barrier();
 
-  // Build FLUDS templates
+  // Build FLUDS templates, one per distinct SPDS
   quadrature_fluds_commondata_map_.clear();
-  if (sweep_type_ == "AAH")
+  std::map<const SPDS*, std::shared_ptr<FLUDSCommonData>> spds_fluds_commondata_map;
+  for (const auto& [quadrature, spds_list] : quadrature_spds_map_)
   {
-    for (const auto& [quadrature, spds_list] : quadrature_spds_map_)
+    for (const auto& spds : spds_list)
     {
-      for (const auto& spds : spds_list)
+      auto& fluds_common_data = spds_fluds_commondata_map[spds.get()];
+      if (not fluds_common_data)
       {
-        quadrature_fluds_commondata_map_[quadrature].push_back(
-          std::make_unique<AAH_FLUDSCommonData>(
-            grid_nodal_mappings_, *spds, *grid_face_histogram_));
+        if (sweep_type_ == "AAH")
+          fluds_common_data = std::make_shared<AAH_FLUDSCommonData>(
+            grid_nodal_mappings_, *spds, *grid_face_histogram_);
+        else
+          fluds_common_data = std::make_shared<CBC_FLUDSCommonData>(*spds, grid_nodal_mappings_);
       }
+      quadrature_fluds_commondata_map_[quadrature].push_back(fluds_common_data);
     }
   }
-  else if (sweep_type_ == "CBC")
+
+  // Report the memory that sharing saved, i.e. the memory the shared SPDS and FLUDS templates
+  // would have taken again for each of the groups that share them
   {
+    size_t num_so_groups = 0;
+    double local_bytes_saved = 0.0;
     for (const auto& [quadrature, spds_list] : quadrature_spds_map_)
     {
-      for (const auto& spds : spds_list)
+      num_so_groups += spds_list.size();
+      std::set<const SPDS*> built_spds;
+      for (size_t so_id = 0; so_id < spds_list.size(); ++so_id)
       {
-        quadrature_fluds_commondata_map_[quadrature].push_back(
-          std::make_unique<CBC_FLUDSCommonData>(*spds, grid_nodal_mappings_));
+        const auto& spds = spds_list[so_id];
+        if (built_spds.insert(spds.get()).second)
+          continue;
+        local_bytes_saved += static_cast<double>(
+          spds->MemoryUsage() + quadrature_fluds_commondata_map_[quadrature][so_id]->MemoryUsage());
       }
     }
+
+    double max_bytes_saved = 0.0;
+    mpi_comm.all_reduce(local_bytes_saved, max_bytes_saved, mpi::op::max<double>());
+    log.Log() << program_timer.GetTimeString() << " Sweep orderings: "
+              << spds_fluds_commondata_map.size() << " distinct SPDS for " << num_so_groups
+              << " sweep-ordering groups. Sharing saved " << std::setprecision(3)
+              << max_bytes_saved / 1048576.0 << " MB per location (maximum).";
   }
 
   log.Log() << program_timer.GetTimeString() << " Done initializing sweep datastructures.\n";
 }
 
+void
+DiscreteOrdinatesSolver::BuildGlobalSweepTDGs(
+  const std::vector<std::shared_ptr<AAH_SPDS>>& spds_list)
+{
+  // Generate the global sweep FAS for each SPDS. This is an expensive operation. It is
+  // distributed via MPI so that multiple MPI ranks can compute the FAS for one or more SPDS
+  // independently.
+  log.Log0Verbose1() << program_timer.GetTimeString() << " Build global sweep FAS for each SPDS.";
+  for (const auto& aah_spds : spds_list)
+  {
+    auto id = aah_spds->Id();
+    if (opensn::mpi_comm.rank() == (id % opensn::mpi_comm.size()))
+      aah_spds->BuildGlobalSweepFAS();
+  }
+
+  // Communicate the FAS for each SPDS to all ranks.
+  log.Log0Verbose1() << program_timer.GetTimeString() << " Gather FAS for each SPDS.";
+  std::vector<int> local_edges_to_remove;
+  for (const auto& aah_spds : spds_list)
+  {
+    auto id = aah_spds->Id();
+    if ((id % opensn::mpi_comm.size()) == opensn::mpi_comm.rank())
+    {
+      auto edges_to_remove = aah_spds->GlobalSweepFAS();
+      local_edges_to_remove.push_back(id);
+      local_edges_to_remove.push_back(static_cast<int>(edges_to_remove.size()));
+      local_edges_to_remove.insert(
+        local_edges_to_remove.end(), edges_to_remove.begin(), edges_to_remove.end());
+    }
+  }
+
+  int local_size = static_cast<int>(local_edges_to_remove.size());
+  std::vector<int> receive_counts(opensn::mpi_comm.size(), 0);
+  std::vector<int> displacements(opensn::mpi_comm.size(), 0);
+  mpi_comm.all_gather(local_size, receive_counts);
+
+  int total_size = 0;
+  for (auto i = 0; i < receive_counts.size(); ++i)
+  {
+    displacements[i] = total_size;
+    total_size += receive_counts[i];
+  }
+
+  std::vector<int> global_edges_to_remove(total_size, 0);
+  mpi_comm.all_gather(
+    local_edges_to_remove, global_edges_to_remove, receive_counts, displacements);
+
+  // Unpack the gathered data and update SPDS on all ranks.
+  int offset = 0;
+  while (offset < global_edges_to_remove.size())
+  {
+    int spds_id = global_edges_to_remove[offset++];
+    int num_edges = global_edges_to_remove[offset++];
+    std::vector<int> edges;
+    for (auto i = 0; i < num_edges; ++i)
+      edges.emplace_back(global_edges_to_remove[offset++]);
+
+    for (const auto& aah_spds : spds_list)
+    {
+      if (aah_spds->Id() == spds_id)
+      {
+        aah_spds->SetGlobalSweepFAS(edges);
+        break;
+      }
+    }
+  }
+
+  // Build TDG for each SPDS on all ranks.
+  log.Log0Verbose1() << program_timer.GetTimeString() << " Build global sweep TDGs.";
+  for (const auto& aah_spds : spds_list)
+    aah_spds->BuildGlobalSweepTDG();
+}
+
 std::pair<UniqueSOGroupings, DirIDToSOMap>
 DiscreteOrdinatesSolver::AssociateSOsAndDirections(const MeshContinuum& grid,
                                                    const AngularQuadrature& quadrature,
@@ -1290,6 +1401,57 @@ DiscreteOrdinatesSolver::AssociateSOsAndDirections(const MeshContinuum& grid,
   return {unq_so_grps, dir_id_to_so_map};
 }
 
+std::vector<size_t>
+DiscreteOrdinatesSolver::FindEquivalentSweepOrderings(const MeshContinuum& grid,
+                                                      const AngularQuadrature& quadrature,
+                                                      const UniqueSOGroupings& so_groupings)
+{
+  CALI_CXX_MARK_SCOPE("DiscreteOrdinatesSolver::FindEquivalentSweepOrderings");
+
+  std::vector<Vector3> omegas;
+  for (const auto& so_grouping : so_groupings)
+    if (not so_grouping.empty())
+      omegas.push_back(quadrature.omegas[so_grouping.front()]);
+  const auto num_sos = static_cast<int>(omegas.size());
+
+  // Locally, each group is a candidate to share the SPDS of the first group with the same face
+  // orientation hash
+  const FaceOrientationNormals face_normals(grid);
+  std::vector<int> local_candidates(num_sos);
+  std::map<uint64_t, int> first_so_with_hash;
+  for (int so = 0; so < num_sos; ++so)
+  {
+    const auto hash = face_normals.Hash(omegas[so]);
+    local_candidates[so] = first_so_with_hash.emplace(hash, so).first->second;
+  }
+
+  // The only group that can be equivalent everywhere is the largest local candidate. Whether it
+  // is, is confirmed by an exact comparison on every location.
+  std::vector<int> candidates(num_sos);
+  mpi_comm.all_reduce(local_candidates, candidates, mpi::op::max<int>());
+
+  std::vector<int> local_confirmed(num_sos, 1);
+  for (int so = 0; so < num_sos; ++so)
+    if (candidates[so] != so and
+        not face_normals.SameOrientations(omegas[so], omegas[candidates[so]]))
+      local_confirmed[so] = 0;
+
+  std::vector<int> confirmed(num_sos);
+  mpi_comm.all_reduce(local_confirmed, confirmed, mpi::op::min<int>());
+
+  // Candidates never exceed the group itself, so the candidate's own mapping is already final
+  std::vector<size_t> equivalent_so(num_sos);
+  for (int so = 0; so < num_sos; ++so)
+  {
+    if (candidates[so] == so or not confirmed[so])
+      equivalent_so[so] = so;
+    else
+      equivalent_so[so] = equivalent_so[candidates[so]];
+  }
+
+  return equivalent_so;
+}
+
 void
 DiscreteOrdinatesSolver::InitFluxDataStructures(LBSGroupset& groupset)
 {
@@ -1376,7 +1538,8 @@ DiscreteOrdinatesSolver::InitFluxDataStructures(LBSGroupset& groupset)
                                                           angle_indices,
                                                           sweep_boundaries_,
                                                           gs_ss,
-                                                          *grid_local_comm_set_);
+                                                          *grid_local_comm_set_,
+                                                          cbc_prioritize_remote_successors_);
 
           angle_set_group.AngleSets().push_back(angle_set);
         }
@@ -1412,7 +1575,9 @@ DiscreteOrdinatesSolver::SetSweepChunk(LBSGroupset& groupset)
                                                        groupset,
                                                        matid_to_xs_map_,
                                                        num_moments_,
-                                                       max_cell_dof_count_);
+                                                       max_cell_dof_count_,
+                                                       pack_sweep_matrices_,
+                                                       sweep_angle_block_size_);
 
     return sweep_chunk;
   }
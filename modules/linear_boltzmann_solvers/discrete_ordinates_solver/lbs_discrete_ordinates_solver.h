@@ -10,6 +10,7 @@ namespace opensn
 {
 
 class CBC_ASynchronousCommunicator;
+class AAH_SPDS;
 
 /**
  * Base class for Discrete Ordinates solvers. This class mostly establishes utilities related to
@@ -27,6 +28,15 @@ public:
 
   const std::string& SweepType() const { return sweep_type_; }
 
+  /// Returns the number of worker threads used to execute anglesets.
+  int NumSweepThreads() const { return num_sweep_threads_; }
+
+  /// Returns the base name of the sweep trace files. Empty when sweep tracing is disabled.
+  const std::string& SweepTraceFile() const { return sweep_trace_file_; }
+
+  /// Returns the maximum number of sweep trace events kept per groupset.
+  size_t SweepTraceBufferSize() const { return sweep_trace_buffer_size_; }
+
   std::pair<size_t, size_t> GetNumPhiIterativeUnknowns() override;
   void Initialize() override;
   void ScalePhiVector(PhiSTLOption which_phi, double value) override;
@@ -90,11 +100,20 @@ protected:
    * iii) is again a mapping, per quadrature, to a collection of Template FLUDS
    * where each FLUDS mirrors a SPDS in ii).
    *
+   * Angle-index-sets whose directions induce identical sweep graphs share one
+   * SPDS in ii) and one Template FLUDS in iii).
+   *
    * The Template FLUDS can be scaled with number of angles and groups which
    * provides us with the angle-set-subset- and groupset-subset capability.
    */
   void InitializeSweepDataStructures();
 
+  /**
+   * Builds the global feedback arc sets and levelized task dependency graphs of the given AAH
+   * SPDS from the gathered location dependencies.
+   */
+  void BuildGlobalSweepTDGs(const std::vector<std::shared_ptr<AAH_SPDS>>& spds_list);
+
   /// Initializes fluds_ data structures.
   void InitFluxDataStructures(LBSGroupset& groupset);
 
@@ -108,11 +127,18 @@ protected:
     quadrature_unq_so_grouping_map_;
   std::map<std::shared_ptr<AngularQuadrature>, std::vector<std::shared_ptr<SPDS>>>
     quadrature_spds_map_;
-  std::map<std::shared_ptr<AngularQuadrature>, std::vector<std::unique_ptr<FLUDSCommonData>>>
+  std::map<std::shared_ptr<AngularQuadrature>, std::vector<std::shared_ptr<FLUDSCommonData>>>
     quadrature_fluds_commondata_map_;
 
   std::vector<size_t> verbose_sweep_angles_;
   const std::string sweep_type_;
+  const int num_sweep_threads_ = 1;
+  const bool pack_sweep_matrices_ = false;
+  const int sweep_angle_block_size_ = 1;
+  const bool cbc_prioritize_remote_successors_ = true;
+  const bool distributed_sweep_setup_ = false;
+  const std::string sweep_trace_file_;
+  const size_t sweep_trace_buffer_size_ = 0;
 
 public:
   static InputParameters GetInputParameters();
@@ -127,6 +153,16 @@ protected:
                             const AngularQuadrature& quadrature,
                             AngleAggregationType agg_type,
                             GeometryType lbs_geo_type);
+
+  /**
+   * Maps each non-empty sweep-ordering group of a quadrature to the lowest-index group that
+   * induces the same face orientations on every location, and hence the same sweep graph. Groups
+   * mapped to the same index can share one SPDS and one set of FLUDS common data. Must be called
+   * collectively.
+   */
+  static std::vector<size_t> FindEquivalentSweepOrderings(const MeshContinuum& grid,
+                                                          const AngularQuadrature& quadrature,
+                                                          const UniqueSOGroupings& so_groupings);
 };
 
 } // namespace opensn
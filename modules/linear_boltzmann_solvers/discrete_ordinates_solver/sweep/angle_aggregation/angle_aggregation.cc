@@ -7,6 +7,9 @@
 #include "framework/logging/log.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace opensn
 {
@@ -39,11 +42,14 @@ AngleAggregation::ZeroOutgoingDelayedPsi()
   for (auto& angsetgrp : angle_set_groups)
     for (auto& angset : angsetgrp.AngleSets())
       for (auto& delayed_data : angset->GetFLUDS().DelayedPrelocIOutgoingPsi())
-        Set(delayed_data, 0.0);
+        std::fill(delayed_data.begin(), delayed_data.end(), 0.0);
 
   for (auto& angsetgrp : angle_set_groups)
     for (auto& angset : angsetgrp.AngleSets())
-      Set(angset->GetFLUDS().DelayedLocalPsi(), 0.0);
+    {
+      auto& delayed_data = angset->GetFLUDS().DelayedLocalPsi();
+      std::fill(delayed_data.begin(), delayed_data.end(), 0.0);
+    }
 }
 
 void
@@ -59,12 +65,8 @@ AngleAggregation::ZeroIncomingDelayedPsi()
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxOld())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto& val : dofvec)
-                  val = 0.0;
+        for (auto& val : rbndry.GetBoundaryFluxOld())
+          val = 0.0;
 
     } // if reflecting
   }   // for bndry
@@ -72,13 +74,16 @@ AngleAggregation::ZeroIncomingDelayedPsi()
   // Intra-cell cycles
   for (auto& as_group : angle_set_groups)
     for (auto& angle_set : as_group.AngleSets())
-      Set(angle_set->GetFLUDS().DelayedLocalPsiOld(), 0.0);
+    {
+      auto& delayed_data = angle_set->GetFLUDS().DelayedLocalPsiOld();
+      std::fill(delayed_data.begin(), delayed_data.end(), 0.0);
+    }
 
   // Inter location cycles
   for (auto& as_group : angle_set_groups)
     for (auto& angle_set : as_group.AngleSets())
       for (auto& loc_vector : angle_set->GetFLUDS().DelayedPrelocIOutgoingPsiOld())
-        Set(loc_vector, 0.0);
+        std::fill(loc_vector.begin(), loc_vector.end(), 0.0);
 }
 
 void
@@ -99,14 +104,12 @@ AngleAggregation::InitializeReflectingBCs()
     if (bndry->IsReflecting())
     {
       size_t tot_num_angles = quadrature_->abscissae.size();
-      size_t num_local_cells = grid_->local_cells.size();
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       const auto& normal = rbndry.Normal();
 
       rbndry.GetReflectedAngleIndexMap().resize(tot_num_angles, -1);
-      rbndry.GetAngleReadyFlags().resize(tot_num_angles,
-                                         std::vector<bool>(num_group_subsets_, false));
+      rbndry.InitializeAngleReadyFlags(num_group_subsets_);
 
       // Determine reflected angle and check that it is within the quadrature
       for (int n = 0; n < tot_num_angles; ++n)
@@ -160,52 +163,8 @@ AngleAggregation::InitializeReflectingBCs()
             "is not aligned with any reflecting axis of the quadrature.");
       }
 
-      // Initialize storage for all outbound directions
-      auto& heteroflux_new = rbndry.GetBoundaryFluxNew();
-      auto& heteroflux_old = rbndry.GetBoundaryFluxOld();
-      heteroflux_new.clear();
-      heteroflux_old.clear();
-      heteroflux_new.resize(tot_num_angles);
-      for (int n = 0; n < tot_num_angles; ++n)
-      {
-        // Only continue if omega is outgoing
-        if (quadrature_->omegas[n].Dot(rbndry.Normal()) < 0.0)
-          continue;
-
-        // For cells
-        auto& cell_vec = heteroflux_new[n];
-        cell_vec.resize(num_local_cells);
-        for (const auto& cell : grid_->local_cells)
-        {
-          const uint64_t c = cell.local_id;
-
-          // Check cell on ref bndry
-          bool on_ref_bndry = false;
-          for (const auto& face : cell.faces)
-          {
-            if ((not face.has_neighbor) and (face.normal.Dot(rbndry.Normal()) > 0.999999))
-            {
-              on_ref_bndry = true;
-              break;
-            }
-          }
-          if (not on_ref_bndry)
-            continue;
-
-          // If cell on ref bndry
-          cell_vec[c].resize(cell.faces.size());
-          int f = 0;
-          for (const auto& face : cell.faces)
-          {
-            if ((not face.has_neighbor) and (face.normal.Dot(rbndry.Normal()) > 0.999999))
-            {
-              cell_vec[c][f].clear();
-              cell_vec[c][f].resize(face.vertex_ids.size(), std::vector<double>(num_groups_, 0.0));
-            }
-            ++f;
-          }
-        } // for cells
-      }   // for angles
+      // Storage for all outbound directions is allocated in Setup
+      Set(rbndry.GetBoundaryFluxNew(), 0.0);
 
       // Determine if boundary is opposing reflecting
       // The boundary with the smallest bid will
@@ -226,9 +185,6 @@ AngleAggregation::InitializeReflectingBCs()
             rbndry.SetOpposingReflected(true);
       }
 
-      if (rbndry.IsOpposingReflected())
-        rbndry.GetBoundaryFluxOld() = rbndry.GetBoundaryFluxNew();
-
       reflecting_bcs_initialized = true;
     } // if reflecting
   }   // for bndry
@@ -257,11 +213,7 @@ AngleAggregation::GetNumDelayedAngularDOFs()
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxNew())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                local_ang_unknowns += dofvec.size();
+        local_ang_unknowns += rbndry.GetBoundaryFluxNew().size();
 
     } // if reflecting
   }   // for bndry
@@ -299,15 +251,11 @@ AngleAggregation::AppendNewDelayedAngularDOFsToArray(int64_t& index, double* x_r
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxNew())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto val : dofvec)
-                {
-                  index++;
-                  x_ref[index] = val;
-                }
+        for (auto val : rbndry.GetBoundaryFluxNew())
+        {
+          index++;
+          x_ref[index] = val;
+        }
 
     } // if reflecting
   }   // for bndry
@@ -345,15 +293,11 @@ AngleAggregation::AppendOldDelayedAngularDOFsToArray(int64_t& index, double* x_r
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxOld())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto val : dofvec)
-                {
-                  index++;
-                  x_ref[index] = val;
-                }
+        for (auto val : rbndry.GetBoundaryFluxOld())
+        {
+          index++;
+          x_ref[index] = val;
+        }
 
     } // if reflecting
   }   // for bndry
@@ -391,15 +335,11 @@ AngleAggregation::SetOldDelayedAngularDOFsFromArray(int64_t& index, const double
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxOld())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto& val : dofvec)
-                {
-                  index++;
-                  val = x_ref[index];
-                }
+        for (auto& val : rbndry.GetBoundaryFluxOld())
+        {
+          index++;
+          val = x_ref[index];
+        }
 
     } // if reflecting
   }   // for bndry
@@ -437,15 +377,11 @@ AngleAggregation::SetNewDelayedAngularDOFsFromArray(int64_t& index, const double
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxNew())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto& val : dofvec)
-                {
-                  index++;
-                  val = x_ref[index];
-                }
+        for (auto& val : rbndry.GetBoundaryFluxNew())
+        {
+          index++;
+          val = x_ref[index];
+        }
 
     } // if reflecting
   }   // for bndry
@@ -488,12 +424,8 @@ AngleAggregation::GetNewDelayedAngularDOFsAsSTLVector()
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxNew())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto val : dofvec)
-                  psi_vector.push_back(val);
+        for (auto val : rbndry.GetBoundaryFluxNew())
+          psi_vector.push_back(val);
 
     } // if reflecting
   }   // for bndry
@@ -536,12 +468,8 @@ AngleAggregation::SetNewDelayedAngularDOFsFromSTLVector(const std::vector<double
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxNew())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto& val : dofvec)
-                  val = stl_vector[index++];
+        for (auto& val : rbndry.GetBoundaryFluxNew())
+          val = stl_vector[index++];
 
     } // if reflecting
   }   // for bndry
@@ -578,12 +506,8 @@ AngleAggregation::GetOldDelayedAngularDOFsAsSTLVector()
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxOld())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto val : dofvec)
-                  psi_vector.push_back(val);
+        for (auto val : rbndry.GetBoundaryFluxOld())
+          psi_vector.push_back(val);
 
     } // if reflecting
   }   // for bndry
@@ -626,12 +550,8 @@ AngleAggregation::SetOldDelayedAngularDOFsFromSTLVector(const std::vector<double
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxOld())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto& val : dofvec)
-                  val = stl_vector[index++];
+        for (auto& val : rbndry.GetBoundaryFluxOld())
+          val = stl_vector[index++];
 
     } // if reflecting
   }   // for bndry
@@ -650,6 +570,62 @@ AngleAggregation::SetOldDelayedAngularDOFsFromSTLVector(const std::vector<double
           val = stl_vector[index++];
 }
 
+double
+AngleAggregation::ComputePointwiseDelayedPsiChange()
+{
+  CALI_CXX_MARK_SCOPE("AngleAggregation::ComputePointwiseDelayedPsiChange");
+
+  double pw_change = 0.0;
+  auto AccumulateChange = [&pw_change](const std::vector<PsiStorage>& psi_new,
+                                       const std::vector<PsiStorage>& psi_old)
+  {
+    for (size_t i = 0; i < psi_new.size(); ++i)
+    {
+      const double new_value = psi_new[i];
+      const double old_value = psi_old[i];
+      const double max = std::max(new_value, old_value);
+      const double delta = std::fabs(new_value - old_value);
+      if (max >= std::numeric_limits<double>::min())
+        pw_change = std::max(delta / max, pw_change);
+      else
+        pw_change = std::max(delta, pw_change);
+    }
+  };
+
+  // Opposing reflecting bndries
+  for (auto& [bid, bndry] : boundaries_)
+  {
+    if (bndry->IsReflecting())
+    {
+      auto& rbndry = (ReflectingBoundary&)(*bndry);
+
+      // The new fluxes were already copied to the old ones when the last sweep finished
+      if (rbndry.IsOpposingReflected())
+        pw_change = std::max(rbndry.GetPointwiseChange(), pw_change);
+    } // if reflecting
+  }   // for bndry
+
+  for (auto& as_group : angle_set_groups)
+    for (auto& angle_set : as_group.AngleSets())
+    {
+      auto& fluds = angle_set->GetFLUDS();
+
+      // Intra-cell cycles
+      AccumulateChange(fluds.DelayedLocalPsi(), fluds.DelayedLocalPsiOld());
+
+      // Inter location cycles
+      const auto& preloc_psi = fluds.DelayedPrelocIOutgoingPsi();
+      const auto& preloc_psi_old = fluds.DelayedPrelocIOutgoingPsiOld();
+      for (size_t l = 0; l < preloc_psi.size(); ++l)
+        AccumulateChange(preloc_psi[l], preloc_psi_old[l]);
+    }
+
+  double global_pw_change = 0.0;
+  mpi_comm.all_reduce<double>(pw_change, global_pw_change, mpi::op::max<double>());
+
+  return global_pw_change;
+}
+
 void
 AngleAggregation::SetDelayedPsiOld2New()
 {
@@ -97,6 +97,12 @@ public:
   /// Gets the current values of the angular unknowns as an STL vector.
   void SetOldDelayedAngularDOFsFromSTLVector(const std::vector<double>& stl_vector);
 
+  /**
+   * Returns the global point-wise change between the new and old delayed angular fluxes, computed
+   * in place on the stored fluxes. Reflecting boundaries report the change over the last sweep.
+   */
+  double ComputePointwiseDelayedPsiChange();
+
   /// Copies the old delayed angular fluxes to the new.
   void SetDelayedPsiOld2New();
 
@@ -54,28 +54,49 @@ AAH_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk, AngleSetStatus permission
     }
 
   if (status == AngleSetStatus::RECEIVING)
+  {
+    TraceWaitBegin();
     return status;
-  else if (status == AngleSetStatus::READY_TO_EXECUTE and permission == AngleSetStatus::EXECUTE)
+  }
+
+  TraceWaitEnd();
+  if (status == AngleSetStatus::READY_TO_EXECUTE and permission == AngleSetStatus::EXECUTE)
   {
-    async_comm_.InitializeLocalAndDownstreamBuffers();
+    PrepareExecution();
 
+    const auto execute_begin = TraceTime();
     sweep_chunk.Sweep(*this); // Execute chunk
+    TraceEvent(SweepEventType::EXECUTE, execute_begin);
 
-    // Send outgoing psi and clear local and receive buffers
-    async_comm_.SendDownstreamPsi(static_cast<int>(this->GetID()));
-    async_comm_.ClearLocalAndReceiveBuffers();
-
-    // Update boundary readiness
-    for (auto& [bid, boundary] : boundaries_)
-      boundary->UpdateAnglesReadyStatus(angles_, group_subset_);
-
-    executed_ = true;
+    FinalizeExecution();
     return AngleSetStatus::FINISHED;
   }
   else
     return AngleSetStatus::READY_TO_EXECUTE;
 }
 
+void
+AAH_AngleSet::PrepareExecution()
+{
+  async_comm_.InitializeLocalAndDownstreamBuffers();
+}
+
+void
+AAH_AngleSet::FinalizeExecution()
+{
+  // Send outgoing psi and clear local and receive buffers
+  const auto send_begin = TraceTime();
+  async_comm_.SendDownstreamPsi(static_cast<int>(this->GetID()));
+  TraceEvent(SweepEventType::SEND, send_begin);
+  async_comm_.ClearLocalAndReceiveBuffers();
+
+  // Update boundary readiness
+  for (auto& [bid, boundary] : boundaries_)
+    boundary->UpdateAnglesReadyStatus(angles_, group_subset_);
+
+  executed_ = true;
+}
+
 AngleSetStatus
 AAH_AngleSet::FlushSendBuffers()
 {
@@ -105,6 +126,7 @@ AAH_AngleSet::ResetSweepBuffers()
 {
   async_comm_.Reset();
   executed_ = false;
+  wait_begin_ = -1;
 }
 
 bool
@@ -123,15 +145,14 @@ AAH_AngleSet::PsiBoundary(uint64_t boundary_id,
                           size_t gs_ss_begin,
                           bool surface_source_active)
 {
-  if (boundaries_[boundary_id]->IsReflecting())
-    return boundaries_[boundary_id]->PsiIncoming(
-      cell_local_id, face_num, fi, angle_num, g, gs_ss_begin);
+  auto& boundary = boundaries_.at(boundary_id);
+  if (boundary->IsReflecting())
+    return boundary->PsiIncoming(cell_local_id, face_num, fi, angle_num, g, gs_ss_begin);
 
   if (not surface_source_active)
-    return boundaries_[boundary_id]->ZeroFlux(g);
+    return boundary->ZeroFlux(g);
 
-  return boundaries_[boundary_id]->PsiIncoming(
-    cell_local_id, face_num, fi, angle_num, g, gs_ss_begin);
+  return boundary->PsiIncoming(cell_local_id, face_num, fi, angle_num, g, gs_ss_begin);
 }
 
 double*
@@ -142,7 +163,8 @@ AAH_AngleSet::PsiReflected(uint64_t boundary_id,
                            unsigned int fi,
                            size_t gs_ss_begin)
 {
-  return boundaries_[boundary_id]->PsiOutgoing(cell_local_id, face_num, fi, angle_num, gs_ss_begin);
+  return boundaries_.at(boundary_id)->PsiOutgoing(
+    cell_local_id, face_num, fi, angle_num, gs_ss_begin);
 }
 
 } // namespace opensn
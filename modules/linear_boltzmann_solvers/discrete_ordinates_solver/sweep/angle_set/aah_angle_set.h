@@ -34,6 +34,12 @@ public:
 
   AngleSetStatus AngleSetAdvance(SweepChunk& sweep_chunk, AngleSetStatus permission) override;
 
+  bool SupportsConcurrentExecution() const override { return true; }
+
+  void PrepareExecution() override;
+
+  void FinalizeExecution() override;
+
   AngleSetStatus FlushSendBuffers() override;
 
   void ResetSweepBuffers() override;
@@ -7,6 +7,7 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/boundary/sweep_boundary.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/communicators/async_comm.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/fluds.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/scheduler/sweep_tracer.h"
 #include "framework/mesh/mesh.h"
 #include "framework/logging/log.h"
 #include <memory>
@@ -28,6 +29,38 @@ protected:
   const size_t group_subset_;
   bool executed_ = false;
 
+  /// Sweep timeline tracer. Null when tracing is disabled.
+  SweepTracer* tracer_ = nullptr;
+  /// Time at which the angleset started waiting for upstream data, or -1 if it is not waiting.
+  int64_t wait_begin_ = -1;
+
+  /// Returns the current trace time, or 0 when tracing is disabled.
+  int64_t TraceTime() const { return tracer_ ? tracer_->Now() : 0; }
+
+  /// Records an event of this angleset that started at `begin` and ends now.
+  void TraceEvent(SweepEventType type, int64_t begin)
+  {
+    if (tracer_)
+      tracer_->Record(type, static_cast<int>(id_), begin, tracer_->Now());
+  }
+
+  /// Marks the angleset as waiting for upstream data, if it is not already.
+  void TraceWaitBegin()
+  {
+    if (tracer_ and wait_begin_ < 0)
+      wait_begin_ = tracer_->Now();
+  }
+
+  /// Records the wait for upstream data that is ending, if any.
+  void TraceWaitEnd()
+  {
+    if (tracer_ and wait_begin_ >= 0)
+    {
+      TraceEvent(SweepEventType::RECEIVE_WAIT, wait_begin_);
+      wait_begin_ = -1;
+    }
+  }
+
 public:
   AngleSet(size_t id,
            size_t num_groups,
@@ -68,6 +101,9 @@ public:
 
   size_t GetNumAngles() const { return angles_.size(); }
 
+  /// Sets the tracer recording the timeline of this angleset. Pass null to disable tracing.
+  void SetTracer(SweepTracer* tracer) { tracer_ = tracer; }
+
   virtual AsynchronousCommunicator* GetCommunicator()
   {
     OpenSnLogicalError("Method not implemented");
@@ -88,6 +124,24 @@ public:
   /// This function advances the work stages of an angleset.
   virtual AngleSetStatus AngleSetAdvance(SweepChunk& sweep_chunk, AngleSetStatus permission) = 0;
 
+  /**
+   * Returns true if the execution of this angleset can be split into PrepareExecution, a sweep
+   * on a worker thread, and FinalizeExecution.
+   */
+  virtual bool SupportsConcurrentExecution() const { return false; }
+
+  /**
+   * Prepares the sweep buffers for executing an angleset that is ready to execute. Called from
+   * the thread driving the communication.
+   */
+  virtual void PrepareExecution() { OpenSnLogicalError("Method not implemented"); }
+
+  /**
+   * Sends downstream data and updates boundary readiness after the sweep of this angleset has
+   * completed. Called from the thread driving the communication.
+   */
+  virtual void FinalizeExecution() { OpenSnLogicalError("Method not implemented"); }
+
   virtual AngleSetStatus FlushSendBuffers() = 0;
 
   /// Resets the sweep buffer.
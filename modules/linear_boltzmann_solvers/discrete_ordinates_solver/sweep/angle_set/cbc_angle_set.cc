@@ -10,6 +10,7 @@
 #include "framework/logging/log.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
+#include <cassert>
 
 namespace opensn
 {
@@ -21,10 +22,12 @@ CBC_AngleSet::CBC_AngleSet(size_t id,
                            const std::vector<size_t>& angle_indices,
                            std::map<uint64_t, std::shared_ptr<SweepBoundary>>& boundaries,
                            size_t group_subset,
-                           const MPICommunicatorSet& comm_set)
+                           const MPICommunicatorSet& comm_set,
+                           bool prioritize_remote_successors)
   : AngleSet(id, num_groups, spds, fluds, angle_indices, boundaries, group_subset),
     cbc_spds_(dynamic_cast<const CBC_SPDS&>(spds_)),
-    async_comm_(id, *fluds, comm_set)
+    async_comm_(id, *fluds, comm_set),
+    prioritize_remote_successors_(prioritize_remote_successors)
 {
 }
 
@@ -34,6 +37,49 @@ CBC_AngleSet::GetCommunicator()
   return static_cast<AsynchronousCommunicator*>(&async_comm_);
 }
 
+void
+CBC_AngleSet::InitializeTaskQueues()
+{
+  const auto& task_list = cbc_spds_.TaskList();
+  const size_t num_tasks = task_list.size();
+
+  num_pending_dependencies_.resize(num_tasks);
+  priority_ready_tasks_.clear();
+  ready_tasks_.clear();
+  priority_ready_tasks_.reserve(num_tasks);
+  ready_tasks_.reserve(num_tasks);
+  priority_ready_head_ = 0;
+  ready_head_ = 0;
+  num_completed_tasks_ = 0;
+
+  for (size_t t = 0; t < num_tasks; ++t)
+  {
+    num_pending_dependencies_[t] = task_list[t].num_dependencies;
+    if (num_pending_dependencies_[t] == 0)
+      EnqueueReadyTask(t);
+  }
+
+  task_queues_initialized_ = true;
+}
+
+void
+CBC_AngleSet::EnqueueReadyTask(uint64_t task_number)
+{
+  if (prioritize_remote_successors_ and cbc_spds_.TaskList()[task_number].has_remote_successors)
+    priority_ready_tasks_.push_back(task_number);
+  else
+    ready_tasks_.push_back(task_number);
+}
+
+void
+CBC_AngleSet::ResolveDependency(uint64_t task_number)
+{
+  // Every upwind face resolves exactly one dependency
+  assert(num_pending_dependencies_[task_number] > 0);
+  if (--num_pending_dependencies_[task_number] == 0)
+    EnqueueReadyTask(task_number);
+}
+
 AngleSetStatus
 CBC_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk, AngleSetStatus permission)
 {
@@ -42,48 +88,64 @@ CBC_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk, AngleSetStatus permission
   if (executed_)
     return AngleSetStatus::FINISHED;
 
-  if (current_task_list_.empty())
-    current_task_list_ = cbc_spds_.TaskList();
+  if (not task_queues_initialized_)
+    InitializeTaskQueues();
+
+  const auto& task_list = cbc_spds_.TaskList();
 
   sweep_chunk.SetAngleSet(*this);
 
-  auto tasks_who_received_data = async_comm_.ReceiveData();
+  const auto& tasks_who_received_data = async_comm_.ReceiveData();
 
   for (const uint64_t task_number : tasks_who_received_data)
-    --current_task_list_[task_number].num_dependencies;
+    ResolveDependency(task_number);
 
   async_comm_.SendData();
 
   // Check if boundaries allow for execution
   for (auto& [bid, boundary] : boundaries_)
     if (not boundary->CheckAnglesReadyStatus(angles_, group_subset_))
+    {
+      TraceWaitBegin();
       return AngleSetStatus::NOT_FINISHED;
-
-  bool all_tasks_completed = true;
-  bool a_task_executed = true;
-  while (a_task_executed)
+    }
+
+  // Sends of downstream data are interleaved with the cell sweeps, so they are traced as part of
+  // the execution
+  const bool has_ready_tasks =
+    priority_ready_head_ < priority_ready_tasks_.size() or ready_head_ < ready_tasks_.size();
+  if (has_ready_tasks)
+    TraceWaitEnd();
+  const auto execute_begin = TraceTime();
+
+  // Execute ready tasks, draining the priority queue first
+  while (true)
   {
-    a_task_executed = false;
-    for (auto& cell_task : current_task_list_)
-    {
-      if (not cell_task.completed)
-        all_tasks_completed = false;
-      if (cell_task.num_dependencies == 0 and not cell_task.completed)
-      {
-        sweep_chunk.SetCell(cell_task.cell_ptr, *this);
-        sweep_chunk.Sweep(*this);
-
-        for (uint64_t local_task_num : cell_task.successors)
-          --current_task_list_[local_task_num].num_dependencies;
-
-        cell_task.completed = true;
-        a_task_executed = true;
-        async_comm_.SendData();
-      }
-    } // for cell_task
+    uint64_t task_number;
+    if (priority_ready_head_ < priority_ready_tasks_.size())
+      task_number = priority_ready_tasks_[priority_ready_head_++];
+    else if (ready_head_ < ready_tasks_.size())
+      task_number = ready_tasks_[ready_head_++];
+    else
+      break;
+
+    const auto& cell_task = task_list[task_number];
+    sweep_chunk.SetCell(cell_task.cell_ptr, *this);
+    sweep_chunk.Sweep(*this);
+
+    for (uint64_t local_task_num : cell_task.successors)
+      ResolveDependency(local_task_num);
+
+    ++num_completed_tasks_;
     async_comm_.SendData();
   }
 
+  if (has_ready_tasks)
+    TraceEvent(SweepEventType::EXECUTE, execute_begin);
+
+  const bool all_tasks_completed = num_completed_tasks_ == task_list.size();
+  if (not all_tasks_completed)
+    TraceWaitBegin();
   const bool all_messages_sent = async_comm_.SendData();
 
   if (all_tasks_completed and all_messages_sent)
@@ -101,10 +163,11 @@ CBC_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk, AngleSetStatus permission
 void
 CBC_AngleSet::ResetSweepBuffers()
 {
-  current_task_list_.clear();
+  task_queues_initialized_ = false;
   async_comm_.Reset();
   fluds_->ClearLocalAndReceivePsi();
   executed_ = false;
+  wait_begin_ = -1;
 }
 
 const double*
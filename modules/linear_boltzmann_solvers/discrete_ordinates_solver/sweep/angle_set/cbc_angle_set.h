@@ -16,8 +16,31 @@ class CBC_AngleSet : public AngleSet
 {
 protected:
   const CBC_SPDS& cbc_spds_;
-  std::vector<Task> current_task_list_;
   CBC_ASynchronousCommunicator async_comm_;
+  /// If true, ready cells with remote successors are swept before other ready cells.
+  const bool prioritize_remote_successors_;
+
+  /// Remaining upwind dependencies of each task in the current sweep.
+  std::vector<unsigned int> num_pending_dependencies_;
+  /**
+   * Ready tasks with and without priority. Every task becomes ready exactly once per sweep, so
+   * each queue is a vector with a read cursor and never reallocates after the first sweep.
+   */
+  std::vector<uint64_t> priority_ready_tasks_;
+  std::vector<uint64_t> ready_tasks_;
+  size_t priority_ready_head_ = 0;
+  size_t ready_head_ = 0;
+  size_t num_completed_tasks_ = 0;
+  bool task_queues_initialized_ = false;
+
+  /// Resets the dependency counters and seeds the ready queues with tasks without dependencies.
+  void InitializeTaskQueues();
+
+  /// Marks a task as ready to execute.
+  void EnqueueReadyTask(uint64_t task_number);
+
+  /// Decrements the dependency counter of a task and enqueues it once it reaches zero.
+  void ResolveDependency(uint64_t task_number);
 
 public:
   CBC_AngleSet(size_t id,
@@ -27,7 +50,8 @@ public:
                const std::vector<size_t>& angle_indices,
                std::map<uint64_t, std::shared_ptr<SweepBoundary>>& boundaries,
                size_t group_subset,
-               const MPICommunicatorSet& comm_set);
+               const MPICommunicatorSet& comm_set,
+               bool prioritize_remote_successors = true);
 
   AsynchronousCommunicator* GetCommunicator() override;
 
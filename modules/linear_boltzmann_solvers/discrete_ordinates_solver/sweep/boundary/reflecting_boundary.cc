@@ -2,12 +2,82 @@
 // SPDX-License-Identifier: MIT
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/boundary/reflecting_boundary.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/math/quadratures/angular/angular_quadrature.h"
 #include "framework/logging/log.h"
 #include "caliper/cali.h"
+#include <algorithm>
+#include <cmath>
 
 namespace opensn
 {
 
+void
+ReflectingBoundary::SetOpposingReflected(bool value)
+{
+  opposing_reflected_ = value;
+  if (opposing_reflected_)
+    boundary_flux_old_ = boundary_flux_;
+  else
+    boundary_flux_old_.clear();
+}
+
+void
+ReflectingBoundary::InitializeAngleReadyFlags(size_t num_group_subsets)
+{
+  // Boundaries are shared by all groupsets, so the stride must fit the largest subset count
+  num_group_subsets_ = std::max(num_group_subsets_, num_group_subsets);
+  angle_readyflags_.assign(angle_offsets_.size() * num_group_subsets_, false);
+}
+
+void
+ReflectingBoundary::Setup(const MeshContinuum& grid, const AngularQuadrature& quadrature)
+{
+  CALI_CXX_MARK_SCOPE("ReflectingBoundary::Setup");
+
+  auto IsOnBoundary = [this](const CellFace& face)
+  { return (not face.has_neighbor) and (face.normal.Dot(normal_) > 0.999999); };
+
+  // Number the nodes of the local faces on the boundary
+  cell_face_offsets_.assign(grid.local_cells.size(), invalid_offset_);
+  face_node_offsets_.clear();
+  size_t num_face_nodes = 0;
+  for (const auto& cell : grid.local_cells)
+  {
+    if (std::none_of(cell.faces.begin(), cell.faces.end(), IsOnBoundary))
+      continue;
+
+    cell_face_offsets_[cell.local_id] = face_node_offsets_.size();
+    for (const auto& face : cell.faces)
+    {
+      if (IsOnBoundary(face))
+      {
+        face_node_offsets_.push_back(num_face_nodes);
+        num_face_nodes += face.vertex_ids.size();
+      }
+      else
+        face_node_offsets_.push_back(invalid_offset_);
+    }
+  }
+
+  // Allocate storage for all outbound directions
+  const size_t num_angles = quadrature.omegas.size();
+  angle_offsets_.assign(num_angles, invalid_offset_);
+  size_t num_unknowns = 0;
+  for (size_t n = 0; n < num_angles; ++n)
+  {
+    if (quadrature.omegas[n].Dot(normal_) < 0.0)
+      continue;
+
+    angle_offsets_[n] = num_unknowns;
+    num_unknowns += num_face_nodes * num_groups_;
+  }
+
+  boundary_flux_.assign(num_unknowns, 0.0);
+  if (opposing_reflected_)
+    boundary_flux_old_ = boundary_flux_;
+}
+
 double*
 ReflectingBoundary::PsiIncoming(uint64_t cell_local_id,
                                 unsigned int face_num,
@@ -16,20 +86,14 @@ ReflectingBoundary::PsiIncoming(uint64_t cell_local_id,
                                 int group_num,
                                 size_t gs_ss_begin)
 {
-  double* psi = nullptr;
-
-  int reflected_angle_num = reflected_anglenum_[angle_num];
+  const int reflected_angle_num = reflected_anglenum_[angle_num];
+  const size_t index = angle_offsets_[reflected_angle_num] +
+                       FaceNodeOffset(cell_local_id, face_num, fi) + gs_ss_begin;
 
   if (opposing_reflected_)
-  {
-    psi = &boundary_flux_old_[reflected_angle_num][cell_local_id][face_num][fi][gs_ss_begin];
-  }
+    return &boundary_flux_old_[index];
   else
-  {
-    psi = &boundary_flux_[reflected_angle_num][cell_local_id][face_num][fi][gs_ss_begin];
-  }
-
-  return psi;
+    return &boundary_flux_[index];
 }
 
 double*
@@ -39,14 +103,15 @@ ReflectingBoundary::PsiOutgoing(uint64_t cell_local_id,
                                 unsigned int angle_num,
                                 size_t gs_ss_begin)
 {
-  return &boundary_flux_[angle_num][cell_local_id][face_num][fi][gs_ss_begin];
+  return &boundary_flux_[angle_offsets_[angle_num] + FaceNodeOffset(cell_local_id, face_num, fi) +
+                         gs_ss_begin];
 }
 
 void
 ReflectingBoundary::UpdateAnglesReadyStatus(const std::vector<size_t>& angles, size_t gs_ss)
 {
   for (const size_t n : angles)
-    angle_readyflags_[reflected_anglenum_[n]][gs_ss] = true;
+    angle_readyflags_[reflected_anglenum_[n] * num_group_subsets_ + gs_ss] = true;
 }
 
 bool
@@ -56,8 +121,8 @@ ReflectingBoundary::CheckAnglesReadyStatus(const std::vector<size_t>& angles, si
     return true;
   bool ready_flag = true;
   for (auto& n : angles)
-    if (not boundary_flux_[reflected_anglenum_[n]].empty())
-      if (not angle_readyflags_[n][gs_ss])
+    if (angle_offsets_[reflected_anglenum_[n]] != invalid_offset_)
+      if (not angle_readyflags_[n * num_group_subsets_ + gs_ss])
         return false;
 
   return ready_flag;
@@ -66,11 +131,25 @@ ReflectingBoundary::CheckAnglesReadyStatus(const std::vector<size_t>& angles, si
 void
 ReflectingBoundary::ResetAnglesReadyStatus()
 {
-  boundary_flux_old_ = boundary_flux_;
+  // Only opposing reflected boundaries read the old fluxes
+  if (opposing_reflected_)
+  {
+    pw_change_ = 0.0;
+    for (size_t i = 0; i < boundary_flux_.size(); ++i)
+    {
+      const double psi_new = boundary_flux_[i];
+      const double psi_old = boundary_flux_old_[i];
+      const double max = std::max(psi_new, psi_old);
+      const double delta = std::fabs(psi_new - psi_old);
+      if (max >= std::numeric_limits<double>::min())
+        pw_change_ = std::max(delta / max, pw_change_);
+      else
+        pw_change_ = std::max(delta, pw_change_);
+      boundary_flux_old_[i] = psi_new;
+    }
+  }
 
-  for (auto& flags : angle_readyflags_)
-    for (int gs_ss = 0; gs_ss < flags.size(); ++gs_ss)
-      flags[gs_ss] = false;
+  std::fill(angle_readyflags_.begin(), angle_readyflags_.end(), false);
 }
 
 } // namespace opensn
@@ -14,18 +14,30 @@ namespace opensn
 class ReflectingBoundary : public SweepBoundary
 {
 protected:
+  static constexpr size_t invalid_offset_ = std::numeric_limits<size_t>::max();
+
   const Vector3 normal_;
   bool opposing_reflected_ = false;
 
-  // Populated by angle aggregation
-  // AngularFluxData indices are: angle, cell per angle, faces per cell, DOFs per face, groups per
-  // DOF
-  using AngularFluxData = std::vector<std::vector<std::vector<std::vector<std::vector<double>>>>>;
-  AngularFluxData boundary_flux_;
-  AngularFluxData boundary_flux_old_;
+  // Built in Setup. The angular fluxes of all outgoing angles are stored contiguously, ordered by
+  // angle, then by node of the local faces on the boundary, then by group.
+  std::vector<double> boundary_flux_;
+  std::vector<double> boundary_flux_old_;
+  /// Offset of the fluxes of each angle, or invalid for incoming angles.
+  std::vector<size_t> angle_offsets_;
+  /// Per local cell, the index of its first face in face_node_offsets_, or invalid.
+  std::vector<size_t> cell_face_offsets_;
+  /// Per face of the cells on the boundary, the offset of its first node within an angle.
+  std::vector<size_t> face_node_offsets_;
 
+  // Populated by angle aggregation
   std::vector<int> reflected_anglenum_;
-  std::vector<std::vector<bool>> angle_readyflags_;
+  /// Ready flags per angle and group subset, stored angle-major.
+  std::vector<bool> angle_readyflags_;
+  size_t num_group_subsets_ = 0;
+
+  /// Point-wise change of the outgoing fluxes over the last sweep.
+  double pw_change_ = 0.0;
 
 public:
   ReflectingBoundary(size_t num_groups,
@@ -39,15 +51,26 @@ public:
 
   bool IsOpposingReflected() const { return opposing_reflected_; }
 
-  void SetOpposingReflected(bool value) { opposing_reflected_ = value; }
+  /// Marks the boundary as opposing reflected, which allocates the old angular fluxes.
+  void SetOpposingReflected(bool value);
 
-  AngularFluxData& GetBoundaryFluxNew() { return boundary_flux_; }
+  std::vector<double>& GetBoundaryFluxNew() { return boundary_flux_; }
 
-  AngularFluxData& GetBoundaryFluxOld() { return boundary_flux_old_; }
+  std::vector<double>& GetBoundaryFluxOld() { return boundary_flux_old_; }
 
   std::vector<int>& GetReflectedAngleIndexMap() { return reflected_anglenum_; }
 
-  std::vector<std::vector<bool>>& GetAngleReadyFlags() { return angle_readyflags_; }
+  /**
+   * Sizes the angle ready flags for a groupset with the given number of group subsets and resets
+   * them to false. The stride is the largest subset count of all groupsets initialized so far.
+   */
+  void InitializeAngleReadyFlags(size_t num_group_subsets);
+
+  /**
+   * Builds the offset tables of the local boundary faces and allocates the angular fluxes of the
+   * outgoing angles, initialized to zero.
+   */
+  void Setup(const MeshContinuum& grid, const AngularQuadrature& quadrature) override;
 
   double* PsiIncoming(uint64_t cell_local_id,
                       unsigned int face_num,
@@ -66,8 +89,24 @@ public:
 
   bool CheckAnglesReadyStatus(const std::vector<size_t>& angles, size_t gs_ss) override;
 
-  /// Resets angle ready flags to false.
+  /**
+   * Returns the point-wise change of the outgoing angular fluxes over the last sweep. Only tracked
+   * on opposing reflected boundaries, whose new fluxes become the old ones when a sweep finishes.
+   */
+  double GetPointwiseChange() const { return pw_change_; }
+
+  /**
+   * Resets angle ready flags to false. On opposing reflected boundaries, also copies the new
+   * angular fluxes to the old, recording the point-wise change between them.
+   */
   void ResetAnglesReadyStatus();
+
+private:
+  /// Returns the offset of the first group of a face node within the fluxes of an angle.
+  size_t FaceNodeOffset(uint64_t cell_local_id, unsigned int face_num, unsigned int fi) const
+  {
+    return (face_node_offsets_[cell_face_offsets_[cell_local_id] + face_num] + fi) * num_groups_;
+  }
 };
 
 } // namespace opensn
@@ -80,9 +80,10 @@ AAH_ASynchronousCommunicator::BuildMessageStructure()
 
   auto message_count_and_size = [this](const auto num_unknowns)
   {
+    const size_t num_bytes = num_unknowns * sizeof(PsiStorage);
     size_t message_count = num_angles_;
-    if (num_unknowns * 8 > max_mpi_message_size_)
-      message_count = ((num_unknowns * 8) + (max_mpi_message_size_ - 1)) / max_mpi_message_size_;
+    if (num_bytes > max_mpi_message_size_)
+      message_count = (num_bytes + (max_mpi_message_size_ - 1)) / max_mpi_message_size_;
     size_t message_size = (num_unknowns + (message_count - 1)) / message_count;
     return std::make_pair(message_count, message_size);
   };
@@ -212,7 +213,7 @@ AAH_ASynchronousCommunicator::ReceiveDelayedData(int angle_set_num)
           all_messages_received = false;
           continue;
         }
-        if (not comm.recv<double>(source, tag, &upstream_psi[block_pos], size).error())
+        if (not comm.recv<PsiStorage>(source, tag, &upstream_psi[block_pos], size).error())
           delayed_preloc_msg_received_[i][m] = true;
       }
     }
@@ -4,27 +4,37 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/communicators/cbc_async_comm.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/spds/spds.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/fluds.h"
-#include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/mpi/mpi_comm_set.h"
 #include "framework/logging/log.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
+#include <cstring>
 
 namespace opensn
 {
 
-std::vector<double>&
-CBC_ASynchronousCommunicator::InitGetDownwindMessageData(int location_id,
-                                                         uint64_t cell_global_id,
-                                                         unsigned int face_id,
-                                                         size_t angle_set_id,
-                                                         size_t data_size)
+CBC_ASynchronousCommunicator::CBC_ASynchronousCommunicator(size_t angle_set_id,
+                                                           FLUDS& fluds,
+                                                           const MPICommunicatorSet& comm_set)
+  : AsynchronousCommunicator(fluds, comm_set),
+    angle_set_id_(angle_set_id),
+    cbc_fluds_(dynamic_cast<CBC_FLUDS&>(fluds))
 {
-  MessageKey key{location_id, cell_global_id, face_id};
-  std::vector<double>& data = outgoing_message_queue_[key];
-  if (data.empty())
-    data.assign(data_size, 0.0);
-  return data;
+  const auto& common_data = cbc_fluds_.CommonData();
+  pending_slots_.resize(common_data.DeplocSlots().size());
+  for (size_t i = 0; i < pending_slots_.size(); ++i)
+    pending_slots_[i].reserve(common_data.DeplocSlots()[i].size());
+
+  recv_buffers_.resize(common_data.PrelocSlots().size());
+}
+
+PsiStorage*
+CBC_ASynchronousCommunicator::InitGetDownwindFaceData(uint64_t cell_local_id,
+                                                      unsigned int face_id)
+{
+  const auto& index = cbc_fluds_.CommonData().GetFaceSlotIndex(cell_local_id, face_id);
+  pending_slots_[index.location_index].push_back(index.slot);
+  return cbc_fluds_.GetNonLocalDownwindFaceData(cell_local_id, face_id);
 }
 
 bool
@@ -32,35 +42,48 @@ CBC_ASynchronousCommunicator::SendData()
 {
   CALI_CXX_MARK_SCOPE("CBC_ASynchronousCommunicator::SendData");
 
-  // First we convert any new outgoing messages from the queue into
-  // buffer messages. We aggregate these messages per location-id
-  // they need to be sent to
-  if (not outgoing_message_queue_.empty())
+  // First we pack the slots written since the last flush into one buffer per location they
+  // need to be sent to
+  const auto& common_data = cbc_fluds_.CommonData();
+  const auto& location_successors = fluds_.GetSPDS().LocationSuccessors();
+  const size_t stride = cbc_fluds_.GetNumGroupsAndAngles();
+  for (size_t deploc = 0; deploc < pending_slots_.size(); ++deploc)
   {
-    std::map<int, BufferItem> locI_buffer_map;
+    auto& pending = pending_slots_[deploc];
+    if (pending.empty())
+      continue;
 
-    for (const auto& [msg_key, data] : outgoing_message_queue_)
+    const auto& slots = common_data.DeplocSlots()[deploc];
+    const auto& slab = cbc_fluds_.DeplocIOutgoingPsi()[deploc];
+
+    size_t num_bytes = 0;
+    for (const int s : pending)
+      num_bytes += sizeof(SlotHeader) + slots[s].num_face_nodes * stride * sizeof(PsiStorage);
+
+    BufferItem buffer_item;
+    buffer_item.destination = location_successors[deploc];
+    if (not free_buffers_.empty())
     {
-      const int locI = std::get<0>(msg_key);
-      const uint64_t cell_global_id = std::get<1>(msg_key);
-      const unsigned int face_id = std::get<2>(msg_key);
-      const size_t data_size = data.size();
-
-      BufferItem& buffer_item = locI_buffer_map[locI];
-      buffer_item.destination = locI;
-      auto& buffer_array = buffer_item.data_array;
-      buffer_array.Write(cell_global_id);
-      buffer_array.Write(face_id);
-      buffer_array.Write(data_size);
-      for (const double value : data) // actual psi_data
-        buffer_array.Write(value);
+      buffer_item.data = std::move(free_buffers_.back());
+      free_buffers_.pop_back();
     }
+    buffer_item.data.resize(num_bytes);
+
+    std::byte* dest = buffer_item.data.data();
+    for (const int s : pending)
+    {
+      const auto header = static_cast<SlotHeader>(s);
+      std::memcpy(dest, &header, sizeof(SlotHeader));
+      dest += sizeof(SlotHeader);
 
-    for (auto& [locI, buffer] : locI_buffer_map)
-      send_buffer_.push_back(std::move(buffer));
+      const size_t slot_bytes = slots[s].num_face_nodes * stride * sizeof(PsiStorage);
+      std::memcpy(dest, &slab[slots[s].node_offset * stride], slot_bytes);
+      dest += slot_bytes;
+    }
 
-    outgoing_message_queue_.clear();
-  } // if there are outgoing messages
+    send_buffer_.push_back(std::move(buffer_item));
+    pending.clear();
+  } // for deploc
 
   // Now we attempt to flush items in the send buffer
   bool all_messages_sent = true;
@@ -72,7 +95,7 @@ CBC_ASynchronousCommunicator::SendData()
       auto& comm = comm_set_.LocICommunicator(locJ);
       auto dest = comm_set_.MapIonJ(locJ, locJ);
       auto tag = static_cast<int>(angle_set_id_);
-      buffer_item.mpi_request = comm.isend(dest, tag, buffer_item.data_array.Data());
+      buffer_item.mpi_request = comm.isend(dest, tag, buffer_item.data);
       buffer_item.send_initiated = true;
     }
 
@@ -88,49 +111,63 @@ CBC_ASynchronousCommunicator::SendData()
   return all_messages_sent;
 }
 
-std::vector<uint64_t>
+const std::vector<uint64_t>&
 CBC_ASynchronousCommunicator::ReceiveData()
 {
   CALI_CXX_MARK_SCOPE("CBC_ASynchronousCommunicator::ReceiveData");
 
-  using CellFaceKey = std::pair<uint64_t, unsigned int>; // cell_gid + face_id
-  std::map<CellFaceKey, std::vector<double>> received_messages;
-  std::vector<uint64_t> cells_who_received_data;
+  cells_who_received_data_.clear();
+
+  const auto& common_data = cbc_fluds_.CommonData();
+  const size_t stride = cbc_fluds_.GetNumGroupsAndAngles();
   auto& location_dependencies = fluds_.GetSPDS().LocationDependencies();
-  for (int locJ : location_dependencies)
+  for (size_t preloc = 0; preloc < location_dependencies.size(); ++preloc)
   {
+    const int locJ = location_dependencies[preloc];
     auto& comm = comm_set_.LocICommunicator(opensn::mpi_comm.rank());
     auto source_rank = comm_set_.MapIonJ(locJ, opensn::mpi_comm.rank());
     auto tag = static_cast<int>(angle_set_id_);
     mpi::Status status;
     if (comm.iprobe(source_rank, tag, status))
     {
-      int num_items = status.get_count<std::byte>();
-      std::vector<std::byte> recv_buffer(num_items);
+      const int num_items = status.get_count<std::byte>();
+      auto& recv_buffer = recv_buffers_[preloc];
+      recv_buffer.resize(num_items);
       comm.recv(source_rank, status.tag(), recv_buffer.data(), num_items);
-      ByteArray data_array(recv_buffer);
 
-      while (not data_array.EndOfBuffer())
+      // Copy each record into its slot of the receive slab
+      const auto& slots = common_data.PrelocSlots()[preloc];
+      auto& slab = cbc_fluds_.PrelocIOutgoingPsi()[preloc];
+      const std::byte* src = recv_buffer.data();
+      const std::byte* const end = src + num_items;
+      while (src < end)
       {
-        const uint64_t cell_global_id = data_array.Read<uint64_t>();
-        const auto face_id = data_array.Read<unsigned int>();
-        const size_t data_size = data_array.Read<size_t>();
-
-        std::vector<double> psi_data;
-        psi_data.reserve(data_size);
-        for (size_t k = 0; k < data_size; ++k)
-          psi_data.push_back(data_array.Read<double>());
-
-        received_messages[{cell_global_id, face_id}] = std::move(psi_data);
-        cells_who_received_data.push_back(
-          fluds_.GetSPDS().Grid().MapCellGlobalID2LocalID(cell_global_id));
+        SlotHeader s;
+        std::memcpy(&s, src, sizeof(SlotHeader));
+        src += sizeof(SlotHeader);
+
+        const auto& slot = slots[s];
+        const size_t slot_bytes = slot.num_face_nodes * stride * sizeof(PsiStorage);
+        std::memcpy(&slab[slot.node_offset * stride], src, slot_bytes);
+        src += slot_bytes;
+
+        cells_who_received_data_.push_back(slot.cell_local_id);
       } // while not at end of buffer
-    }   // Process each message embedded in buffer
+    }   // if a message is pending
   }
 
-  cbc_fluds_.DeplocsOutgoingMessages().merge(received_messages);
+  return cells_who_received_data_;
+}
+
+void
+CBC_ASynchronousCommunicator::Reset()
+{
+  for (auto& pending : pending_slots_)
+    pending.clear();
 
-  return cells_who_received_data;
+  for (auto& buffer_item : send_buffer_)
+    free_buffers_.push_back(std::move(buffer_item.data));
+  send_buffer_.clear();
 }
 
 } // namespace opensn
@@ -5,9 +5,7 @@
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/communicators/async_comm.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/cbc_fluds.h"
-#include "framework/data_types/byte_array.h"
 #include "mpicpp-lite/mpicpp-lite.h"
-#include <map>
 #include <vector>
 #include <cstdint>
 #include <cstddef>
@@ -18,44 +16,45 @@ namespace opensn
 {
 
 class MPICommunicatorSet;
-class ByteArray;
 class CBC_FLUDS;
 
+/**
+ * Asynchronous communicator for cell-by-cell sweeps. Outgoing face psi is written by the sweep
+ * chunk directly into the per-location send slabs of the CBC_FLUDS and received psi is copied
+ * straight into the receive slabs, where the sweep chunk reads it in place. A message is a
+ * sequence of records, each made of a slot index followed by the psi of that slot. Slot
+ * numbering is agreed upon by construction (see CBC_FLUDSCommonData).
+ */
 class CBC_ASynchronousCommunicator : public AsynchronousCommunicator
 {
 public:
   explicit CBC_ASynchronousCommunicator(size_t angle_set_id,
                                         FLUDS& fluds,
-                                        const MPICommunicatorSet& comm_set)
-    : AsynchronousCommunicator(fluds, comm_set),
-      angle_set_id_(angle_set_id),
-      cbc_fluds_(dynamic_cast<CBC_FLUDS&>(fluds))
-  {
-  }
+                                        const MPICommunicatorSet& comm_set);
 
-  std::vector<double>& InitGetDownwindMessageData(int location_id,
-                                                  uint64_t cell_global_id,
-                                                  unsigned int face_id,
-                                                  size_t angle_set_id,
-                                                  size_t data_size) override;
+  /**
+   * Returns the send-slab storage of a non-local outgoing face and queues the face for sending
+   * on the next call to SendData. Must be called once per face and cell visit, since every call
+   * queues another record.
+   */
+  PsiStorage* InitGetDownwindFaceData(uint64_t cell_local_id, unsigned int face_id);
 
   bool SendData();
 
-  std::vector<uint64_t> ReceiveData();
+  /// Receives pending messages and returns the local ids of the cells that received data.
+  const std::vector<uint64_t>& ReceiveData();
 
-  void Reset()
-  {
-    outgoing_message_queue_.clear();
-    send_buffer_.clear();
-  }
+  void Reset();
 
 protected:
+  /// Wire type of the slot index preceding each record.
+  using SlotHeader = uint32_t;
+
   const size_t angle_set_id_;
   CBC_FLUDS& cbc_fluds_;
 
-  // location_id, cell_global_id, face_id
-  using MessageKey = std::tuple<int, uint64_t, unsigned int>;
-  std::map<MessageKey, std::vector<double>> outgoing_message_queue_;
+  /// Slots written since the last flush, per location successor.
+  std::vector<std::vector<int>> pending_slots_;
 
   struct BufferItem
   {
@@ -63,9 +62,15 @@ protected:
     mpi::Request mpi_request;
     bool send_initiated = false;
     bool completed = false;
-    ByteArray data_array;
+    std::vector<std::byte> data;
   };
   std::vector<BufferItem> send_buffer_;
+  /// Storage of completed send buffers, recycled across sweeps.
+  std::vector<std::vector<std::byte>> free_buffers_;
+
+  /// Receive buffers, one per location dependency, reused across probes.
+  std::vector<std::vector<std::byte>> recv_buffers_;
+  std::vector<uint64_t> cells_who_received_data_;
 };
 
 } // namespace opensn
@@ -23,7 +23,7 @@ AAH_FLUDS::AAH_FLUDS(size_t num_groups, size_t num_angles, const AAH_FLUDSCommon
     common_data_.delayed_local_psi_Gn_block_stride_ * num_groups_;
 }
 
-double*
+PsiStorage*
 AAH_FLUDS::OutgoingPsi(int cell_so_index, int outb_face_counter, int face_dof, int n)
 {
   // Face category
@@ -49,7 +49,7 @@ AAH_FLUDS::OutgoingPsi(int cell_so_index, int outb_face_counter, int face_dof, i
   }
 }
 
-double*
+PsiStorage*
 AAH_FLUDS::NLOutgoingPsi(int outb_face_counter, int face_dof, int n)
 {
   if (outb_face_counter > common_data_.nonlocal_outb_face_deplocI_slot_.size())
@@ -76,7 +76,7 @@ AAH_FLUDS::NLOutgoingPsi(int outb_face_counter, int face_dof, int n)
   return &deplocI_outgoing_psi_[depLocI][index];
 }
 
-double*
+PsiStorage*
 AAH_FLUDS::UpwindPsi(int cell_so_index, int inc_face_counter, int face_dof, int g, int n)
 {
   // Face category
@@ -110,7 +110,7 @@ AAH_FLUDS::UpwindPsi(int cell_so_index, int inc_face_counter, int face_dof, int
   }
 }
 
-double*
+PsiStorage*
 AAH_FLUDS::NLUpwindPsi(int nonl_inc_face_counter, int face_dof, int g, int n)
 {
   int prelocI = common_data_.nonlocal_inc_face_prelocI_slot_dof_[nonl_inc_face_counter].first;
@@ -167,10 +167,10 @@ AAH_FLUDS::GetDeplocIFaceDOFCount(int deplocI) const
 void
 AAH_FLUDS::ClearLocalAndReceivePsi()
 {
-  auto empty_vector = std::vector<std::vector<double>>(0);
+  auto empty_vector = std::vector<std::vector<PsiStorage>>(0);
   local_psi_.swap(empty_vector);
 
-  empty_vector = std::vector<std::vector<double>>(0);
+  empty_vector = std::vector<std::vector<PsiStorage>>(0);
   prelocI_outgoing_psi_.swap(empty_vector);
 }
 
@@ -196,7 +196,7 @@ AAH_FLUDS::AllocateInternalLocalPsi(size_t num_grps, size_t num_angles)
 void
 AAH_FLUDS::AllocateOutgoingPsi(size_t num_grps, size_t num_angles, size_t num_loc_sucs)
 {
-  deplocI_outgoing_psi_.resize(num_loc_sucs, std::vector<double>());
+  deplocI_outgoing_psi_.resize(num_loc_sucs, std::vector<PsiStorage>());
   for (size_t deplocI = 0; deplocI < num_loc_sucs; ++deplocI)
   {
     deplocI_outgoing_psi_[deplocI].resize(
@@ -220,7 +220,7 @@ AAH_FLUDS::AllocateDelayedLocalPsi(size_t num_grps, size_t num_angles)
 void
 AAH_FLUDS::AllocatePrelocIOutgoingPsi(size_t num_grps, size_t num_angles, size_t num_loc_deps)
 {
-  prelocI_outgoing_psi_.resize(num_loc_deps, std::vector<double>());
+  prelocI_outgoing_psi_.resize(num_loc_deps, std::vector<PsiStorage>());
   for (size_t prelocI = 0; prelocI < num_loc_deps; ++prelocI)
   {
     prelocI_outgoing_psi_[prelocI].resize(
@@ -250,36 +250,36 @@ AAH_FLUDS::AllocateDelayedPrelocIOutgoingPsi(size_t num_grps,
   }
 }
 
-std::vector<double>&
+std::vector<PsiStorage>&
 AAH_FLUDS::DelayedLocalPsi()
 {
   return delayed_local_psi_;
 }
 
-std::vector<double>&
+std::vector<PsiStorage>&
 AAH_FLUDS::DelayedLocalPsiOld()
 {
   return delayed_local_psi_old_;
 }
 
-std::vector<std::vector<double>>&
+std::vector<std::vector<PsiStorage>>&
 AAH_FLUDS::DeplocIOutgoingPsi()
 {
   return deplocI_outgoing_psi_;
 }
 
-std::vector<std::vector<double>>&
+std::vector<std::vector<PsiStorage>>&
 AAH_FLUDS::PrelocIOutgoingPsi()
 {
   return prelocI_outgoing_psi_;
 }
 
-std::vector<std::vector<double>>&
+std::vector<std::vector<PsiStorage>>&
 AAH_FLUDS::DelayedPrelocIOutgoingPsi()
 {
   return delayed_prelocI_outgoing_psi_;
 }
-std::vector<std::vector<double>>&
+std::vector<std::vector<PsiStorage>>&
 AAH_FLUDS::DelayedPrelocIOutgoingPsiOld()
 {
   return delayed_prelocI_outgoing_psi_old_;
@@ -29,15 +29,15 @@ private:
 
   size_t delayed_local_psi_Gn_block_strideG_; // Custom G
 
-  std::vector<std::vector<double>> local_psi_;
-  std::vector<double> delayed_local_psi_;
-  std::vector<double> delayed_local_psi_old_;
-  std::vector<std::vector<double>> deplocI_outgoing_psi_;
-  std::vector<std::vector<double>> prelocI_outgoing_psi_;
-  std::vector<std::vector<double>> boundryI_incoming_psi_;
+  std::vector<std::vector<PsiStorage>> local_psi_;
+  std::vector<PsiStorage> delayed_local_psi_;
+  std::vector<PsiStorage> delayed_local_psi_old_;
+  std::vector<std::vector<PsiStorage>> deplocI_outgoing_psi_;
+  std::vector<std::vector<PsiStorage>> prelocI_outgoing_psi_;
+  std::vector<std::vector<PsiStorage>> boundryI_incoming_psi_;
 
-  std::vector<std::vector<double>> delayed_prelocI_outgoing_psi_;
-  std::vector<std::vector<double>> delayed_prelocI_outgoing_psi_old_;
+  std::vector<std::vector<PsiStorage>> delayed_prelocI_outgoing_psi_;
+  std::vector<std::vector<PsiStorage>> delayed_prelocI_outgoing_psi_old_;
 
 public:
   /**
@@ -45,23 +45,23 @@ public:
    * computes the location of this position's upwind psi in the local upwind psi vector and returns
    * a reference to it.
    */
-  double* OutgoingPsi(int cell_so_index, int outb_face_counter, int face_dof, int n);
+  PsiStorage* OutgoingPsi(int cell_so_index, int outb_face_counter, int face_dof, int n);
 
   /**
    * Given a sweep ordering index, the incoming face counter, the incoming face dof, this function
    * computes the location where to store this position's outgoing psi and returns a reference to
    * it.
    */
-  double* UpwindPsi(int cell_so_index, int inc_face_counter, int face_dof, int g, int n);
+  PsiStorage* UpwindPsi(int cell_so_index, int inc_face_counter, int face_dof, int g, int n);
 
   /// Given a outbound face counter this method returns a pointer to the location
-  double* NLOutgoingPsi(int outb_face_count, int face_dof, int n);
+  PsiStorage* NLOutgoingPsi(int outb_face_count, int face_dof, int n);
 
   /**
    * Given a sweep ordering index, the incoming face counter, the incoming face dof, this function
    * computes the location where to obtain the position's upwind psi.
    */
-  double* NLUpwindPsi(int nonl_inc_face_counter, int face_dof, int g, int n);
+  PsiStorage* NLUpwindPsi(int nonl_inc_face_counter, int face_dof, int g, int n);
 
   size_t GetPrelocIFaceDOFCount(int prelocI) const;
   size_t GetDelayedPrelocIFaceDOFCount(int prelocI) const;
@@ -78,15 +78,15 @@ public:
                                          size_t num_angles,
                                          size_t num_loc_deps) override;
 
-  std::vector<double>& DelayedLocalPsi() override;
-  std::vector<double>& DelayedLocalPsiOld() override;
+  std::vector<PsiStorage>& DelayedLocalPsi() override;
+  std::vector<PsiStorage>& DelayedLocalPsiOld() override;
 
-  std::vector<std::vector<double>>& DeplocIOutgoingPsi() override;
+  std::vector<std::vector<PsiStorage>>& DeplocIOutgoingPsi() override;
 
-  std::vector<std::vector<double>>& PrelocIOutgoingPsi() override;
+  std::vector<std::vector<PsiStorage>>& PrelocIOutgoingPsi() override;
 
-  std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsi() override;
-  std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsiOld() override;
+  std::vector<std::vector<PsiStorage>>& DelayedPrelocIOutgoingPsi() override;
+  std::vector<std::vector<PsiStorage>>& DelayedPrelocIOutgoingPsiOld() override;
 };
 
 } // namespace opensn
@@ -6,6 +6,7 @@
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/mesh/mesh_continuum/grid_face_histogram.h"
 #include "framework/logging/log.h"
+#include "framework/utils/utils.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
 #include <algorithm>
@@ -25,6 +26,52 @@ AAH_FLUDSCommonData::AAH_FLUDSCommonData(
   this->InitializeBetaElements(spds);
 }
 
+size_t
+AAH_FLUDSCommonData::MemoryUsage() const
+{
+  auto CellViewsMemoryUsage = [](const std::vector<std::vector<CompactCellView>>& cell_views)
+  {
+    size_t bytes = VectorMemoryUsage(cell_views);
+    for (const auto& location_views : cell_views)
+      for (const auto& cell_view : location_views)
+      {
+        bytes += VectorMemoryUsage(cell_view.second);
+        for (const auto& face_view : cell_view.second)
+          bytes += VectorMemoryUsage(face_view.second);
+      }
+    return bytes;
+  };
+
+  auto SlotDofMemoryUsage =
+    [](const std::vector<std::pair<int, std::pair<int, std::vector<int>>>>& slot_dofs)
+  {
+    size_t bytes = VectorMemoryUsage(slot_dofs);
+    for (const auto& slot_dof : slot_dofs)
+      bytes += VectorMemoryUsage(slot_dof.second.second);
+    return bytes;
+  };
+
+  size_t bytes = VectorMemoryUsage(local_psi_stride_) + VectorMemoryUsage(local_psi_max_elements_) +
+                 VectorMemoryUsage(local_psi_n_block_stride_) +
+                 VectorMemoryUsage(local_psi_Gn_block_strideG_) +
+                 VectorMemoryUsage(deplocI_face_dof_count_) +
+                 VectorMemoryUsage(so_cell_outb_face_slot_indices_) +
+                 VectorMemoryUsage(so_cell_outb_face_face_category_) +
+                 VectorMemoryUsage(so_cell_inco_face_face_category_) +
+                 VectorMemoryUsage(so_cell_inco_face_dof_indices_) +
+                 VectorMemoryUsage(nonlocal_outb_face_deplocI_slot_) +
+                 VectorMemoryUsage(prelocI_face_dof_count_) +
+                 VectorMemoryUsage(delayed_prelocI_face_dof_count_);
+  for (const auto& cell_faces : so_cell_inco_face_dof_indices_)
+    for (const auto& face_info : cell_faces)
+      bytes += VectorMemoryUsage(face_info.upwind_dof_mapping);
+  bytes += CellViewsMemoryUsage(deplocI_cell_views_) + CellViewsMemoryUsage(prelocI_cell_views_) +
+           CellViewsMemoryUsage(delayed_prelocI_cell_views_);
+  bytes += SlotDofMemoryUsage(nonlocal_inc_face_prelocI_slot_dof_) +
+           SlotDofMemoryUsage(delayed_nonlocal_inc_face_prelocI_slot_dof_);
+  return bytes;
+}
+
 void
 AAH_FLUDSCommonData::InitializeAlphaElements(const SPDS& spds,
                                              const GridFaceHistogram& grid_face_histogram)
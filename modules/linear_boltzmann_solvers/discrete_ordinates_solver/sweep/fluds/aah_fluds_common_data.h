@@ -45,6 +45,8 @@ public:
                                const SPDS& spds,
                                const GridFaceHistogram& grid_face_histogram);
 
+  size_t MemoryUsage() const override;
+
 protected:
   friend class AAH_FLUDS;
   int largest_face_ = 0;
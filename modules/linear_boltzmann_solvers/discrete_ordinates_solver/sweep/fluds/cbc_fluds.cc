@@ -21,9 +21,18 @@ CBC_FLUDS::CBC_FLUDS(size_t num_groups,
     psi_uk_man_(psi_uk_man),
     sdm_(sdm)
 {
+  const auto& deploc_slab_nodes = common_data_.DeplocSlabNodes();
+  deplocI_outgoing_psi_.resize(deploc_slab_nodes.size());
+  for (size_t i = 0; i < deploc_slab_nodes.size(); ++i)
+    deplocI_outgoing_psi_[i].assign(deploc_slab_nodes[i] * num_groups_and_angles_, 0.0);
+
+  const auto& preloc_slab_nodes = common_data_.PrelocSlabNodes();
+  prelocI_outgoing_psi_.resize(preloc_slab_nodes.size());
+  for (size_t i = 0; i < preloc_slab_nodes.size(); ++i)
+    prelocI_outgoing_psi_[i].assign(preloc_slab_nodes[i] * num_groups_and_angles_, 0.0);
 }
 
-const FLUDSCommonData&
+const CBC_FLUDSCommonData&
 CBC_FLUDS::CommonData() const
 {
   return common_data_;
@@ -42,19 +51,29 @@ CBC_FLUDS::GetLocalCellUpwindPsi(const std::vector<double>& psi_data_block, cons
   return &psi_data_block[dof_map];
 }
 
-const std::vector<double>&
-CBC_FLUDS::GetNonLocalUpwindData(uint64_t cell_global_id, unsigned int face_id) const
+const PsiStorage*
+CBC_FLUDS::GetNonLocalUpwindFaceData(uint64_t cell_local_id, unsigned int face_id) const
 {
-  return deplocs_outgoing_messages_.at({cell_global_id, face_id});
+  const auto& index = common_data_.GetFaceSlotIndex(cell_local_id, face_id);
+  const auto& slot = common_data_.PrelocSlots()[index.location_index][index.slot];
+  return &prelocI_outgoing_psi_[index.location_index][slot.node_offset * num_groups_and_angles_];
 }
 
-const double*
-CBC_FLUDS::GetNonLocalUpwindPsi(const std::vector<double>& psi_data,
+const PsiStorage*
+CBC_FLUDS::GetNonLocalUpwindPsi(const PsiStorage* face_data,
                                 unsigned int face_node_mapped,
-                                unsigned int angle_set_index)
+                                unsigned int angle_set_index) const
 {
   const size_t dof_map = face_node_mapped * num_groups_and_angles_ + angle_set_index * num_groups_;
-  return &psi_data[dof_map];
+  return &face_data[dof_map];
+}
+
+PsiStorage*
+CBC_FLUDS::GetNonLocalDownwindFaceData(uint64_t cell_local_id, unsigned int face_id)
+{
+  const auto& index = common_data_.GetFaceSlotIndex(cell_local_id, face_id);
+  const auto& slot = common_data_.DeplocSlots()[index.location_index][index.slot];
+  return &deplocI_outgoing_psi_[index.location_index][slot.node_offset * num_groups_and_angles_];
 }
 
 } // namespace opensn
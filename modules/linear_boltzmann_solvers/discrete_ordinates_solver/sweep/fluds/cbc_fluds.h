@@ -5,7 +5,6 @@
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/cbc_fluds_common_data.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/fluds.h"
-#include <map>
 #include <functional>
 
 namespace opensn
@@ -25,20 +24,27 @@ public:
             const UnknownManager& psi_uk_man,
             const SpatialDiscretization& sdm);
 
-  const FLUDSCommonData& CommonData() const;
+  const CBC_FLUDSCommonData& CommonData() const;
 
   const std::vector<double>& GetLocalUpwindDataBlock() const;
 
   const double* GetLocalCellUpwindPsi(const std::vector<double>& psi_data_block, const Cell& cell);
 
-  const std::vector<double>& GetNonLocalUpwindData(uint64_t cell_global_id,
-                                                   unsigned int face_id) const;
+  /// Returns the incoming psi of a non-local face, read in place from the receive slab.
+  const PsiStorage* GetNonLocalUpwindFaceData(uint64_t cell_local_id, unsigned int face_id) const;
 
-  const double* GetNonLocalUpwindPsi(const std::vector<double>& psi_data,
-                                     unsigned int face_node_mapped,
-                                     unsigned int angle_set_index);
+  const PsiStorage* GetNonLocalUpwindPsi(const PsiStorage* face_data,
+                                         unsigned int face_node_mapped,
+                                         unsigned int angle_set_index) const;
 
-  void ClearLocalAndReceivePsi() override { deplocs_outgoing_messages_.clear(); }
+  /// Returns the storage of a non-local outgoing face within the send slab of its location.
+  PsiStorage* GetNonLocalDownwindFaceData(uint64_t cell_local_id, unsigned int face_id);
+
+  /// Returns the number of values stored per face node (groups times angles).
+  size_t GetNumGroupsAndAngles() const { return num_groups_and_angles_; }
+
+  /// Slabs are fully overwritten every sweep, so there is nothing to clear.
+  void ClearLocalAndReceivePsi() override {}
   void ClearSendPsi() override {}
   void AllocateInternalLocalPsi(size_t num_grps, size_t num_angles) override {}
   void AllocateOutgoingPsi(size_t num_grps, size_t num_angles, size_t num_loc_sucs) override {}
@@ -53,46 +59,44 @@ public:
   {
   }
 
-  std::vector<double>& DelayedLocalPsi() override { return delayed_local_psi_; }
-  std::vector<double>& DelayedLocalPsiOld() override { return delayed_local_psi_old_; }
+  std::vector<PsiStorage>& DelayedLocalPsi() override { return delayed_local_psi_; }
+  std::vector<PsiStorage>& DelayedLocalPsiOld() override { return delayed_local_psi_old_; }
 
-  std::vector<std::vector<double>>& DeplocIOutgoingPsi() override { return deplocI_outgoing_psi_; }
+  std::vector<std::vector<PsiStorage>>& DeplocIOutgoingPsi() override
+  {
+    return deplocI_outgoing_psi_;
+  }
 
-  std::vector<std::vector<double>>& PrelocIOutgoingPsi() override { return prelocI_outgoing_psi_; }
+  std::vector<std::vector<PsiStorage>>& PrelocIOutgoingPsi() override
+  {
+    return prelocI_outgoing_psi_;
+  }
 
-  std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsi() override
+  std::vector<std::vector<PsiStorage>>& DelayedPrelocIOutgoingPsi() override
   {
     return delayed_prelocI_outgoing_psi_;
   }
-  std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsiOld() override
+  std::vector<std::vector<PsiStorage>>& DelayedPrelocIOutgoingPsiOld() override
   {
     return delayed_prelocI_outgoing_psi_old_;
   }
 
-  // cell_global_id, face_id
-  using CellFaceKey = std::pair<uint64_t, unsigned int>;
-
-  std::map<CellFaceKey, std::vector<double>>& DeplocsOutgoingMessages()
-  {
-    return deplocs_outgoing_messages_;
-  }
-
 private:
   const CBC_FLUDSCommonData& common_data_;
   std::reference_wrapper<std::vector<double>> local_psi_data_;
   const UnknownManager& psi_uk_man_;
   const SpatialDiscretization& sdm_;
 
-  std::vector<double> delayed_local_psi_;
-  std::vector<double> delayed_local_psi_old_;
-  std::vector<std::vector<double>> deplocI_outgoing_psi_;
-  std::vector<std::vector<double>> prelocI_outgoing_psi_;
-  std::vector<std::vector<double>> boundryI_incoming_psi_;
-
-  std::vector<std::vector<double>> delayed_prelocI_outgoing_psi_;
-  std::vector<std::vector<double>> delayed_prelocI_outgoing_psi_old_;
+  std::vector<PsiStorage> delayed_local_psi_;
+  std::vector<PsiStorage> delayed_local_psi_old_;
+  /// Send slabs, one per location successor, laid out by the common data slot table.
+  std::vector<std::vector<PsiStorage>> deplocI_outgoing_psi_;
+  /// Receive slabs, one per location dependency, laid out by the common data slot table.
+  std::vector<std::vector<PsiStorage>> prelocI_outgoing_psi_;
+  std::vector<std::vector<PsiStorage>> boundryI_incoming_psi_;
 
-  std::map<CellFaceKey, std::vector<double>> deplocs_outgoing_messages_;
+  std::vector<std::vector<PsiStorage>> delayed_prelocI_outgoing_psi_;
+  std::vector<std::vector<PsiStorage>> delayed_prelocI_outgoing_psi_old_;
 };
 
 } // namespace opensn
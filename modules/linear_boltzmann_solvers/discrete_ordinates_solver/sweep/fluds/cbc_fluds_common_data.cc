@@ -4,6 +4,10 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/cbc_fluds_common_data.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/spds/spds.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/logging/log_exceptions.h"
+#include "framework/utils/utils.h"
+#include <algorithm>
+#include <tuple>
 
 namespace opensn
 {
@@ -12,6 +16,96 @@ CBC_FLUDSCommonData::CBC_FLUDSCommonData(
   const SPDS& spds, const std::vector<CellFaceNodalMapping>& grid_nodal_mappings)
   : FLUDSCommonData(spds, grid_nodal_mappings)
 {
+  const auto& grid = spds.Grid();
+  const auto& face_orientations = spds.CellFaceOrientations();
+
+  // Receiving cell global id, receiving face id and the slot itself
+  using SlotCandidate = std::tuple<uint64_t, unsigned int, NonLocalFaceSlot>;
+  std::vector<std::vector<SlotCandidate>> deploc_candidates(spds.LocationSuccessors().size());
+  std::vector<std::vector<SlotCandidate>> preloc_candidates(spds.LocationDependencies().size());
+
+  cell_face_offsets_.reserve(grid.local_cells.size());
+  size_t num_cell_faces = 0;
+  for (const auto& cell : grid.local_cells)
+  {
+    cell_face_offsets_.push_back(num_cell_faces);
+    num_cell_faces += cell.faces.size();
+  }
+  face_slot_indices_.assign(num_cell_faces, FaceSlotIndex{});
+
+  for (const auto& cell : grid.local_cells)
+  {
+    for (unsigned int f = 0; f < cell.faces.size(); ++f)
+    {
+      const auto& face = cell.faces[f];
+      if (not face.has_neighbor or grid.IsCellLocal(face.neighbor_id))
+        continue;
+
+      const auto& nodal_mapping = grid_nodal_mappings_[cell.local_id][f];
+      const int locJ = face.GetNeighborPartitionID(grid);
+      const NonLocalFaceSlot slot{cell.local_id, f, nodal_mapping.face_node_mapping_.size(), 0};
+
+      const auto orientation = face_orientations[cell.local_id][f];
+      if (orientation == FaceOrientation::OUTGOING)
+      {
+        const int deploc = spds.MapLocJToDeplocI(locJ);
+        const auto ass_face = static_cast<unsigned int>(nodal_mapping.associated_face_);
+        deploc_candidates[deploc].emplace_back(face.neighbor_id, ass_face, slot);
+      }
+      else if (orientation == FaceOrientation::INCOMING)
+      {
+        const int preloc = spds.MapLocJToPrelocI(locJ);
+        OpenSnLogicalErrorIf(preloc < 0,
+                             "CBC sweeps do not support delayed location dependencies.");
+        preloc_candidates[preloc].emplace_back(cell.global_id, f, slot);
+      }
+    }
+  }
+
+  // Both sides of a location pair sort on the receiving cell-face, which yields identical slot
+  // numbering on the sender and the receiver.
+  auto BuildSlots = [this](std::vector<std::vector<SlotCandidate>>& candidates,
+                           std::vector<std::vector<NonLocalFaceSlot>>& slots,
+                           std::vector<size_t>& slab_nodes)
+  {
+    slots.assign(candidates.size(), {});
+    slab_nodes.assign(candidates.size(), 0);
+    for (size_t loc = 0; loc < candidates.size(); ++loc)
+    {
+      auto& loc_candidates = candidates[loc];
+      std::sort(loc_candidates.begin(),
+                loc_candidates.end(),
+                [](const SlotCandidate& a, const SlotCandidate& b)
+                {
+                  const auto& [a_gid, a_face, a_slot] = a;
+                  const auto& [b_gid, b_face, b_slot] = b;
+                  return std::tie(a_gid, a_face) < std::tie(b_gid, b_face);
+                });
+
+      slots[loc].reserve(loc_candidates.size());
+      for (auto& [gid, face_id, slot] : loc_candidates)
+      {
+        slot.node_offset = slab_nodes[loc];
+        slab_nodes[loc] += slot.num_face_nodes;
+
+        auto& index = face_slot_indices_[cell_face_offsets_[slot.cell_local_id] + slot.face_id];
+        index.location_index = static_cast<int>(loc);
+        index.slot = static_cast<int>(slots[loc].size());
+        slots[loc].push_back(slot);
+      }
+    }
+  };
+
+  BuildSlots(deploc_candidates, deploc_slots_, deploc_slab_nodes_);
+  BuildSlots(preloc_candidates, preloc_slots_, preloc_slab_nodes_);
+}
+
+size_t
+CBC_FLUDSCommonData::MemoryUsage() const
+{
+  return VectorMemoryUsage(deploc_slots_) + VectorMemoryUsage(preloc_slots_) +
+         VectorMemoryUsage(deploc_slab_nodes_) + VectorMemoryUsage(preloc_slab_nodes_) +
+         VectorMemoryUsage(cell_face_offsets_) + VectorMemoryUsage(face_slot_indices_);
 }
 
 } // namespace opensn
@@ -5,6 +5,8 @@
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/fluds_common_data.h"
 #include <cinttypes>
+#include <cstddef>
+#include <vector>
 
 namespace opensn
 {
@@ -12,8 +14,62 @@ namespace opensn
 class CBC_FLUDSCommonData : public FLUDSCommonData
 {
 public:
+  /// A cell face whose angular flux is exchanged with another location.
+  struct NonLocalFaceSlot
+  {
+    uint64_t cell_local_id = 0;
+    unsigned int face_id = 0;
+    /// Number of face nodes carried by the slot.
+    size_t num_face_nodes = 0;
+    /// Offset of the slot, in face nodes, within the slab of its location.
+    size_t node_offset = 0;
+  };
+
+  /// Location of a non-local face within the slot tables.
+  struct FaceSlotIndex
+  {
+    /// Deploc index for outgoing faces, preloc index for incoming faces, -1 otherwise.
+    int location_index = -1;
+    /// Index of the slot within the location's slot list.
+    int slot = -1;
+  };
+
   CBC_FLUDSCommonData(const SPDS& spds,
                       const std::vector<CellFaceNodalMapping>& grid_nodal_mappings);
+
+  size_t MemoryUsage() const override;
+
+  /**
+   * Outgoing slots per location successor (deploc). Slots are ordered by the global id and face
+   * index of the receiving cell, so the receiving location derives the same slot numbering from
+   * its incoming faces without any handshake.
+   */
+  const std::vector<std::vector<NonLocalFaceSlot>>& DeplocSlots() const { return deploc_slots_; }
+
+  /// Incoming slots per location dependency (preloc), ordered like the sender's outgoing slots.
+  const std::vector<std::vector<NonLocalFaceSlot>>& PrelocSlots() const { return preloc_slots_; }
+
+  /// Total number of face nodes in the slab of each deploc.
+  const std::vector<size_t>& DeplocSlabNodes() const { return deploc_slab_nodes_; }
+
+  /// Total number of face nodes in the slab of each preloc.
+  const std::vector<size_t>& PrelocSlabNodes() const { return preloc_slab_nodes_; }
+
+  /// Returns the slot of a non-local incoming or outgoing face.
+  const FaceSlotIndex& GetFaceSlotIndex(uint64_t cell_local_id, unsigned int face_id) const
+  {
+    return face_slot_indices_[cell_face_offsets_[cell_local_id] + face_id];
+  }
+
+private:
+  std::vector<std::vector<NonLocalFaceSlot>> deploc_slots_;
+  std::vector<std::vector<NonLocalFaceSlot>> preloc_slots_;
+  std::vector<size_t> deploc_slab_nodes_;
+  std::vector<size_t> preloc_slab_nodes_;
+
+  /// Offset of the first face of each local cell into `face_slot_indices_`.
+  std::vector<size_t> cell_face_offsets_;
+  std::vector<FaceSlotIndex> face_slot_indices_;
 };
 
 } // namespace opensn
@@ -15,6 +15,21 @@ namespace opensn
 class GridFaceHistogram;
 class SPDS;
 
+/**
+ * Precision of the angular fluxes stored between cells and exchanged between locations during a
+ * sweep. Cell solves and flux moment accumulation are always carried out in double precision.
+ *
+ * This includes the delayed angular fluxes of cyclic dependencies, which are unknowns of the
+ * Krylov within-groupset solvers. In single precision, their round-off (about 1e-7 relative)
+ * bounds the residual reduction those solvers can reach on problems with cycles. Reflecting
+ * boundary fluxes are not affected: they stay in double like all other sweep boundaries.
+ */
+#ifdef OPENSN_WITH_FLOAT_PSI
+using PsiStorage = float;
+#else
+using PsiStorage = double;
+#endif
+
 class FLUDS
 {
 public:
@@ -40,16 +55,16 @@ public:
   {
   }
 
-  virtual std::vector<double>& DelayedLocalPsi() = 0;
-  virtual std::vector<double>& DelayedLocalPsiOld() = 0;
+  virtual std::vector<PsiStorage>& DelayedLocalPsi() = 0;
+  virtual std::vector<PsiStorage>& DelayedLocalPsiOld() = 0;
 
-  virtual std::vector<std::vector<double>>& DeplocIOutgoingPsi() = 0;
+  virtual std::vector<std::vector<PsiStorage>>& DeplocIOutgoingPsi() = 0;
 
-  virtual std::vector<std::vector<double>>& PrelocIOutgoingPsi() = 0;
+  virtual std::vector<std::vector<PsiStorage>>& PrelocIOutgoingPsi() = 0;
 
-  virtual std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsi() = 0;
+  virtual std::vector<std::vector<PsiStorage>>& DelayedPrelocIOutgoingPsi() = 0;
 
-  virtual std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsiOld() = 0;
+  virtual std::vector<std::vector<PsiStorage>>& DelayedPrelocIOutgoingPsiOld() = 0;
 
   virtual ~FLUDS() = default;
 
@@ -5,6 +5,7 @@
 
 #include <vector>
 #include <cstdint>
+#include <cstddef>
 
 namespace opensn
 {
@@ -39,6 +40,9 @@ public:
 
   virtual ~FLUDSCommonData() = default;
 
+  /// Returns an estimate of the memory, in bytes, held by this common data.
+  virtual size_t MemoryUsage() const = 0;
+
   const SPDS& GetSPDS() const;
   const FaceNodalMapping& GetFaceNodalMapping(uint64_t cell_local_id, unsigned int face_id) const;
 
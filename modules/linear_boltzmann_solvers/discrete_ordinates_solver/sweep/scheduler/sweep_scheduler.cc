@@ -9,13 +9,19 @@
 #include "caliper/cali.h"
 #include <sstream>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
 
 namespace opensn
 {
 
 SweepScheduler::SweepScheduler(SchedulingAlgorithm scheduler_type,
                                AngleAggregation& angle_agg,
-                               SweepChunk& sweep_chunk)
+                               SweepChunk& sweep_chunk,
+                               int num_sweep_threads)
   : scheduler_type_(scheduler_type), angle_agg_(angle_agg), sweep_chunk_(sweep_chunk)
 {
   CALI_CXX_MARK_SCOPE("SweepScheduler::SweepScheduler");
@@ -25,6 +31,25 @@ SweepScheduler::SweepScheduler(SchedulingAlgorithm scheduler_type,
   if (scheduler_type_ == SchedulingAlgorithm::DEPTH_OF_GRAPH)
     InitializeAlgoDOG();
 
+  // Set up the worker threads for concurrent angleset execution
+  if (num_sweep_threads > 1)
+  {
+    bool anglesets_support_threads = true;
+    for (const auto& rule_value : rule_values_)
+      if (not rule_value.angle_set->SupportsConcurrentExecution())
+        anglesets_support_threads = false;
+
+    if (scheduler_type_ == SchedulingAlgorithm::DEPTH_OF_GRAPH and anglesets_support_threads and
+        sweep_chunk_.SupportsConcurrentSweeps())
+    {
+      thread_pool_ = std::make_unique<SweepThreadPool>(num_sweep_threads);
+      sweep_chunk_.InitializeWorkerBuffers(num_sweep_threads);
+    }
+    else
+      log.Log0Warning() << "SweepScheduler: Threaded sweeps are only supported for AAH sweeps. "
+                        << "Anglesets will be executed serially.";
+  }
+
   // Initialize delayed upstream data
   for (auto& angsetgrp : angle_agg.angle_set_groups)
     for (auto& angset : angsetgrp.AngleSets())
@@ -46,6 +71,25 @@ SweepScheduler::SweepScheduler(SchedulingAlgorithm scheduler_type,
       angset->SetMaxBufferMessages(global_max_num_messages);
 }
 
+SweepScheduler::~SweepScheduler()
+{
+  if (tracer_)
+    for (auto& angle_set_group : angle_agg_.angle_set_groups)
+      for (auto& angle_set : angle_set_group.AngleSets())
+        angle_set->SetTracer(nullptr);
+}
+
+void
+SweepScheduler::EnableTracing(const std::string& file_base, size_t capacity)
+{
+  const int num_workers = thread_pool_ ? thread_pool_->NumWorkers() : 1;
+  tracer_ = std::make_unique<SweepTracer>(file_base, capacity, num_workers);
+
+  for (auto& angle_set_group : angle_agg_.angle_set_groups)
+    for (auto& angle_set : angle_set_group.AngleSets())
+      angle_set->SetTracer(tracer_.get());
+}
+
 SweepChunk&
 SweepScheduler::GetSweepChunk()
 {
@@ -70,21 +114,7 @@ SweepScheduler::InitializeAlgoDOG()
       auto angleset = angleset_group.AngleSets()[as];
       const auto& spds = dynamic_cast<const AAH_SPDS&>(angleset->GetSPDS());
 
-      const std::vector<STDG>& leveled_graph = spds.GlobalSweepPlanes();
-
-      // Find location depth
-      int loc_depth = -1;
-      for (size_t level = 0; level < leveled_graph.size(); ++level)
-      {
-        for (size_t index = 0; index < leveled_graph[level].item_id.size(); ++index)
-        {
-          if (leveled_graph[level].item_id[index] == opensn::mpi_comm.rank())
-          {
-            loc_depth = static_cast<int>(leveled_graph.size() - level);
-            break;
-          }
-        } // for locations in plane
-      }   // for sweep planes
+      const int loc_depth = spds.LocationDepth();
 
       // Set up rule values
       if (loc_depth >= 0)
@@ -197,37 +227,153 @@ SweepScheduler::ScheduleAlgoDOG(SweepChunk& sweep_chunk)
     } // for each angleset rule
   }   // while not finished
 
-  // Receive delayed data
-  opensn::mpi_comm.barrier();
-  bool received_delayed_data = false;
-  while (not received_delayed_data)
+  FinalizeSweep();
+}
+
+void
+SweepScheduler::ScheduleAlgoDOGThreaded(SweepChunk& sweep_chunk)
+{
+  CALI_CXX_MARK_SCOPE("SweepScheduler::ScheduleAlgoDOGThreaded");
+
+  const int num_workers = thread_pool_->NumWorkers();
+  const size_t num_rules = rule_values_.size();
+
+  sweep_chunk.InitializeWorkerBuffers(num_workers);
+
+  // Anglesets handed to a worker are not advanced by this thread until the worker signals
+  // completion. Only this thread touches the communicators.
+  std::vector<bool> in_flight(num_rules, false);
+  auto sweep_done = std::make_unique<std::atomic<bool>[]>(num_rules);
+  // Execution times recorded by the workers and traced by this thread
+  std::vector<int64_t> execute_begin(num_rules, 0);
+  std::vector<int64_t> execute_end(num_rules, 0);
+  const SweepTracer* tracer = tracer_.get();
+  std::exception_ptr worker_exception;
+  std::mutex worker_exception_mutex;
+
+  // Workers set their done flag, count the completion and notify under this mutex, so that this
+  // thread can sleep until a worker finishes instead of spinning.
+  std::mutex completion_mutex;
+  std::condition_variable completion_condition;
+  size_t num_completions = 0;
+
+  auto WaitForWorkers = [&]()
   {
-    received_delayed_data = true;
+    std::unique_lock<std::mutex> lock(completion_mutex);
+    for (size_t r = 0; r < num_rules; ++r)
+      if (in_flight[r])
+        completion_condition.wait(
+          lock, [&sweep_done, r]() { return sweep_done[r].load(std::memory_order_acquire); });
+  };
 
-    for (auto& angle_set_group : angle_agg_.angle_set_groups)
-      for (auto& angle_set : angle_set_group.AngleSets())
+  bool finished = false;
+  while (not finished)
+  {
+    finished = true;
+    bool made_progress = false;
+    bool any_in_flight = false;
+    size_t num_completions_at_pass_start = 0;
+    {
+      std::lock_guard<std::mutex> lock(completion_mutex);
+      num_completions_at_pass_start = num_completions;
+    }
+
+    for (size_t r = 0; r < num_rules; ++r)
+    {
+      auto angleset = rule_values_[r].angle_set;
+
+      // Complete anglesets whose sweep has finished on a worker
+      if (in_flight[r])
       {
-        if (angle_set->FlushSendBuffers() == AngleSetStatus::MESSAGES_PENDING)
-          received_delayed_data = false;
+        if (not sweep_done[r].load(std::memory_order_acquire))
+        {
+          finished = false;
+          any_in_flight = true;
+          continue;
+        }
+        in_flight[r] = false;
 
-        if (not angle_set->ReceiveDelayedData())
-          received_delayed_data = false;
+        std::exception_ptr exception;
+        {
+          std::lock_guard<std::mutex> lock(worker_exception_mutex);
+          exception = worker_exception;
+        }
+        if (exception)
+        {
+          WaitForWorkers();
+          std::rethrow_exception(exception);
+        }
+
+        if (tracer_)
+          tracer_->Record(SweepEventType::EXECUTE,
+                          static_cast<int>(angleset->GetID()),
+                          execute_begin[r],
+                          execute_end[r]);
+        angleset->FinalizeExecution();
+        made_progress = true;
       }
-  }
 
-  // Reset all
-  for (auto& angle_set_group : angle_agg_.angle_set_groups)
-    for (auto& angle_set : angle_set_group.AngleSets())
-      angle_set->ResetSweepBuffers();
+      AngleSetStatus status =
+        angleset->AngleSetAdvance(sweep_chunk, AngleSetStatus::NO_EXEC_IF_READY);
 
-  for (auto& [bid, bndry] : angle_agg_.GetSimBoundaries())
-  {
-    if (bndry->Type() == BoundaryType::REFLECTING)
+      // Hand ready anglesets to their worker
+      if (status == AngleSetStatus::READY_TO_EXECUTE)
+      {
+        angleset->PrepareExecution();
+        in_flight[r] = true;
+        sweep_done[r].store(false, std::memory_order_relaxed);
+        thread_pool_->Submit(
+          static_cast<int>(r % num_workers),
+          [&, r, angleset](int worker_index)
+          {
+            try
+            {
+              if (tracer)
+                execute_begin[r] = tracer->Now();
+              sweep_chunk.WorkerSweep(*angleset, worker_index);
+              if (tracer)
+                execute_end[r] = tracer->Now();
+            }
+            catch (...)
+            {
+              std::lock_guard<std::mutex> lock(worker_exception_mutex);
+              if (not worker_exception)
+                worker_exception = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock(completion_mutex);
+            sweep_done[r].store(true, std::memory_order_release);
+            ++num_completions;
+            completion_condition.notify_one();
+          });
+        made_progress = true;
+        any_in_flight = true;
+      }
+
+      if (status != AngleSetStatus::FINISHED)
+        finished = false;
+    } // for each angleset rule
+
+    // With sweeps running on the workers, sleep until one of them completes. The wait is bounded
+    // because only this thread progresses the communication of the other anglesets. Without
+    // sweeps in flight, keep polling the communicators as ScheduleAlgoDOG does.
+    if (not made_progress and any_in_flight)
     {
-      auto rbndry = std::static_pointer_cast<ReflectingBoundary>(bndry);
-      rbndry->ResetAnglesReadyStatus();
+      std::unique_lock<std::mutex> lock(completion_mutex);
+      completion_condition.wait_for(
+        lock,
+        std::chrono::microseconds(50),
+        [&]() { return num_completions != num_completions_at_pass_start; });
     }
+  } // while not finished
+
+  // The last worker to complete may still hold the completion mutex
+  {
+    std::lock_guard<std::mutex> lock(completion_mutex);
   }
+
+  sweep_chunk.ReduceWorkerBuffers();
+
+  FinalizeSweep();
 }
 
 void
@@ -251,7 +397,16 @@ SweepScheduler::ScheduleAlgoFIFO(SweepChunk& sweep_chunk)
       } // for angleset
   }     // while not finished
 
+  FinalizeSweep();
+}
+
+void
+SweepScheduler::FinalizeSweep()
+{
+  CALI_CXX_MARK_SCOPE("SweepScheduler::FinalizeSweep");
+
   // Receive delayed data
+  const auto delayed_data_begin = tracer_ ? tracer_->Now() : 0;
   opensn::mpi_comm.barrier();
   bool received_delayed_data = false;
   while (not received_delayed_data)
@@ -268,6 +423,9 @@ SweepScheduler::ScheduleAlgoFIFO(SweepChunk& sweep_chunk)
           received_delayed_data = false;
       }
   }
+  if (tracer_)
+    tracer_->Record(
+      SweepEventType::DELAYED_DATA_RECEIVE, -1, delayed_data_begin, tracer_->Now());
 
   // Reset all
   for (auto& angle_set_group : angle_agg_.angle_set_groups)
@@ -289,10 +447,21 @@ SweepScheduler::Sweep()
 {
   CALI_CXX_MARK_SCOPE("SweepScheduler::Sweep");
 
+  if (tracer_)
+    tracer_->BeginSweep();
+
   if (scheduler_type_ == SchedulingAlgorithm::FIRST_IN_FIRST_OUT)
     ScheduleAlgoFIFO(sweep_chunk_);
   else if (scheduler_type_ == SchedulingAlgorithm::DEPTH_OF_GRAPH)
-    ScheduleAlgoDOG(sweep_chunk_);
+  {
+    if (thread_pool_)
+      ScheduleAlgoDOGThreaded(sweep_chunk_);
+    else
+      ScheduleAlgoDOG(sweep_chunk_);
+  }
+
+  if (tracer_)
+    tracer_->EndSweep();
 }
 
 void
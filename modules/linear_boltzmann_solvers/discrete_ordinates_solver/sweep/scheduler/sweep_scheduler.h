@@ -4,7 +4,10 @@
 #pragma once
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/angle_aggregation/angle_aggregation.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/scheduler/sweep_thread_pool.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/scheduler/sweep_tracer.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/sweep_chunk.h"
+#include <memory>
 
 namespace opensn
 {
@@ -45,13 +48,38 @@ private:
 
   SweepChunk& sweep_chunk_;
 
+  /// Worker threads used to execute anglesets concurrently. Null for serial sweeps.
+  std::unique_ptr<SweepThreadPool> thread_pool_;
+
+  /// Timeline tracer. Null unless tracing is enabled.
+  std::unique_ptr<SweepTracer> tracer_;
+
 public:
+  /**
+   * Constructs a sweep scheduler. When `num_sweep_threads` is greater than one, and both the
+   * scheduling algorithm and the sweep chunk allow it, ready anglesets are swept concurrently
+   * on a pool of worker threads while the calling thread drives all communication.
+   */
   SweepScheduler(SchedulingAlgorithm scheduler_type,
                  AngleAggregation& angle_agg,
-                 SweepChunk& sweep_chunk);
+                 SweepChunk& sweep_chunk,
+                 int num_sweep_threads = 1);
+
+  /// Detaches the tracer, if any, from the anglesets and writes its trace.
+  ~SweepScheduler();
 
   AngleAggregation& AngleAgg() { return angle_agg_; }
 
+  /**
+   * Enables the sweep timeline tracer. The trace of each location is written to
+   * `<file_base>.<location id>.json` when the scheduler is destroyed, and at most `capacity`
+   * of the most recent events are kept. Collective.
+   */
+  void EnableTracing(const std::string& file_base, size_t capacity);
+
+  /// Returns the timeline tracer, or null when tracing is disabled.
+  const SweepTracer* Tracer() const { return tracer_.get(); }
+
   /// This is the entry point for sweeping.
   void Sweep();
 
@@ -68,6 +96,16 @@ private:
   /// Executes the Depth-Of-Graph algorithm.
   void ScheduleAlgoDOG(SweepChunk& sweep_chunk);
 
+  /**
+   * Executes the Depth-Of-Graph algorithm with anglesets swept on the worker threads. Each
+   * angleset is bound to a fixed worker so that the flux moment accumulation is reproducible for
+   * a given number of threads.
+   */
+  void ScheduleAlgoDOGThreaded(SweepChunk& sweep_chunk);
+
+  /// Receives delayed data and resets the sweep buffers and boundaries after a sweep.
+  void FinalizeSweep();
+
 public:
   /// Sets the location where flux moments are to be written.
   void SetDestinationPhi(std::vector<double>& destination_phi);
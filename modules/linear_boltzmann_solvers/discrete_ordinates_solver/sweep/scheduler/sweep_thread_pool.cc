@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/scheduler/sweep_thread_pool.h"
+#include "framework/logging/log_exceptions.h"
+
+namespace opensn
+{
+
+SweepThreadPool::SweepThreadPool(int num_workers)
+{
+  OpenSnInvalidArgumentIf(num_workers < 1, "Number of sweep worker threads must be positive.");
+
+  workers_.reserve(num_workers);
+  for (int w = 0; w < num_workers; ++w)
+    workers_.push_back(std::make_unique<Worker>());
+
+  for (int w = 0; w < num_workers; ++w)
+  {
+    auto& worker = *workers_[w];
+    worker.thread = std::thread([this, &worker, w]() { WorkerLoop(worker, w); });
+  }
+}
+
+SweepThreadPool::~SweepThreadPool()
+{
+  for (auto& worker : workers_)
+  {
+    {
+      std::lock_guard<std::mutex> lock(worker->mutex);
+      worker->stop = true;
+    }
+    worker->condition.notify_one();
+  }
+
+  for (auto& worker : workers_)
+    if (worker->thread.joinable())
+      worker->thread.join();
+}
+
+void
+SweepThreadPool::Submit(int worker_index, Task task)
+{
+  auto& worker = *workers_.at(worker_index);
+  {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.queue.push_back(std::move(task));
+  }
+  worker.condition.notify_one();
+}
+
+void
+SweepThreadPool::WorkerLoop(Worker& worker, int worker_index)
+{
+  while (true)
+  {
+    Task task;
+    {
+      std::unique_lock<std::mutex> lock(worker.mutex);
+      worker.condition.wait(lock, [&worker]() { return worker.stop or not worker.queue.empty(); });
+
+      if (worker.queue.empty())
+        return;
+
+      task = std::move(worker.queue.front());
+      worker.queue.pop_front();
+    }
+
+    task(worker_index);
+  }
+}
+
+} // namespace opensn
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace opensn
+{
+
+/**
+ * A fixed-size pool of worker threads used by the sweep scheduler to execute angleset sweeps
+ * concurrently. Every worker owns its own FIFO queue and tasks are bound to a worker by the
+ * caller. This keeps the mapping between anglesets and per-worker accumulation buffers fixed
+ * for a given thread count. Worker threads never perform MPI communication; all communication
+ * progress is driven by the thread that owns the pool.
+ */
+class SweepThreadPool
+{
+public:
+  /// A task receives the index of the worker executing it.
+  using Task = std::function<void(int worker_index)>;
+
+  explicit SweepThreadPool(int num_workers);
+  ~SweepThreadPool();
+
+  SweepThreadPool(const SweepThreadPool&) = delete;
+  SweepThreadPool& operator=(const SweepThreadPool&) = delete;
+
+  /// Returns the number of worker threads.
+  int NumWorkers() const { return static_cast<int>(workers_.size()); }
+
+  /// Appends a task to the queue of the given worker.
+  void Submit(int worker_index, Task task);
+
+private:
+  struct Worker
+  {
+    std::thread thread;
+    std::deque<Task> queue;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool stop = false;
+  };
+
+  /// Main loop of a worker thread.
+  void WorkerLoop(Worker& worker, int worker_index);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+};
+
+} // namespace opensn
@@ -0,0 +1,180 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/scheduler/sweep_tracer.h"
+#include "framework/logging/log.h"
+#include "framework/runtime.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <set>
+#include <stdexcept>
+
+namespace opensn
+{
+
+namespace
+{
+
+int64_t
+SteadyClockNanoseconds()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+const char*
+EventName(SweepEventType type)
+{
+  switch (type)
+  {
+    case SweepEventType::RECEIVE_WAIT:
+      return "receive-wait";
+    case SweepEventType::EXECUTE:
+      return "execute";
+    case SweepEventType::SEND:
+      return "send";
+    case SweepEventType::DELAYED_DATA_RECEIVE:
+      return "delayed-data-receive";
+  }
+  return "unknown";
+}
+
+} // namespace
+
+SweepTracer::SweepTracer(const std::string& file_base, size_t capacity, int num_workers)
+  : file_name_(file_base + "." + std::to_string(opensn::mpi_comm.rank()) + ".json"),
+    num_workers_(std::max(num_workers, 1)),
+    events_(std::max<size_t>(capacity, 1))
+{
+  opensn::mpi_comm.barrier();
+  origin_ = SteadyClockNanoseconds();
+}
+
+SweepTracer::~SweepTracer()
+{
+  try
+  {
+    WriteChromeTrace();
+  }
+  catch (const std::exception& e)
+  {
+    log.LogAllWarning() << "SweepTracer: Failed to write " << file_name_ << ": " << e.what();
+  }
+}
+
+int64_t
+SweepTracer::Now() const
+{
+  return SteadyClockNanoseconds() - origin_;
+}
+
+void
+SweepTracer::BeginSweep()
+{
+  sweep_begin_ = Now();
+  sweep_execute_time_ = 0;
+}
+
+void
+SweepTracer::EndSweep()
+{
+  const double wall_time = static_cast<double>(Now() - sweep_begin_) * 1.0e-9;
+  const double execute_time = static_cast<double>(sweep_execute_time_) * 1.0e-9;
+
+  double max_wall_time = 0.0;
+  double total_execute_time = 0.0;
+  opensn::mpi_comm.all_reduce(wall_time, max_wall_time, mpi::op::max<double>());
+  opensn::mpi_comm.all_reduce(execute_time, total_execute_time, mpi::op::sum<double>());
+
+  const double capacity = max_wall_time * opensn::mpi_comm.size() * num_workers_;
+  const double efficiency = capacity > 0.0 ? total_execute_time / capacity : 0.0;
+  sweep_summaries_.push_back({max_wall_time, efficiency});
+
+  log.Log0Verbose1() << "Sweep " << sweep_count_ << ": time " << max_wall_time
+                     << " s, parallel efficiency " << efficiency;
+  ++sweep_count_;
+}
+
+void
+SweepTracer::Record(SweepEventType type, int angle_set_id, int64_t begin, int64_t end)
+{
+  if (type == SweepEventType::EXECUTE)
+    sweep_execute_time_ += end - begin;
+
+  events_[next_event_] = {begin, end, angle_set_id, sweep_count_, type};
+  next_event_ = (next_event_ + 1) % events_.size();
+  num_events_ = std::min(num_events_ + 1, events_.size());
+}
+
+void
+SweepTracer::LogSummary(const std::string& label) const
+{
+  if (sweep_summaries_.empty())
+    return;
+
+  const auto num_sweeps = static_cast<double>(sweep_summaries_.size());
+  double min_efficiency = sweep_summaries_.front().efficiency;
+  double max_efficiency = min_efficiency;
+  double sum_efficiency = 0.0;
+  double sum_wall_time = 0.0;
+  for (const auto& summary : sweep_summaries_)
+  {
+    min_efficiency = std::min(min_efficiency, summary.efficiency);
+    max_efficiency = std::max(max_efficiency, summary.efficiency);
+    sum_efficiency += summary.efficiency;
+    sum_wall_time += summary.wall_time;
+  }
+
+  log.Log() << label << ": " << sweep_summaries_.size() << " traced sweeps, average time "
+            << sum_wall_time / num_sweeps << " s, parallel efficiency average "
+            << sum_efficiency / num_sweeps << ", min " << min_efficiency << ", max "
+            << max_efficiency;
+}
+
+void
+SweepTracer::WriteChromeTrace() const
+{
+  std::ofstream file(file_name_, std::ofstream::out | std::ofstream::trunc);
+  if (not file.is_open())
+    throw std::runtime_error("Unable to open file.");
+
+  const int pid = opensn::mpi_comm.rank();
+  const size_t first = (next_event_ + events_.size() - num_events_) % events_.size();
+
+  // Chrome trace timestamps and durations are in microseconds
+  file << std::fixed << std::setprecision(3);
+  file << "{\"traceEvents\":[\n";
+  file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid
+       << ",\"args\":{\"name\":\"location " << pid << "\"}}";
+
+  // Name the track of every angleset. The location-wide events go on track 0.
+  std::set<int> angle_set_ids;
+  for (size_t i = 0; i < num_events_; ++i)
+    angle_set_ids.insert(events_[(first + i) % events_.size()].angle_set_id);
+  for (const int id : angle_set_ids)
+  {
+    file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << id + 1
+         << ",\"args\":{\"name\":\"";
+    if (id < 0)
+      file << "location";
+    else
+      file << "angleset " << id;
+    file << "\"}}";
+  }
+
+  for (size_t i = 0; i < num_events_; ++i)
+  {
+    const auto& event = events_[(first + i) % events_.size()];
+    file << ",\n{\"name\":\"" << EventName(event.type) << "\",\"cat\":\"sweep\",\"ph\":\"X\""
+         << ",\"pid\":" << pid << ",\"tid\":" << event.angle_set_id + 1
+         << ",\"ts\":" << static_cast<double>(event.begin) * 1.0e-3
+         << ",\"dur\":" << static_cast<double>(event.end - event.begin) * 1.0e-3
+         << ",\"args\":{\"sweep\":" << event.sweep << "}}";
+  }
+  file << "\n]}\n";
+}
+
+} // namespace opensn
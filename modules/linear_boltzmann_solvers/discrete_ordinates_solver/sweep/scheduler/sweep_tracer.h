@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace opensn
+{
+
+/// Kinds of events recorded by the sweep tracer.
+enum class SweepEventType : uint8_t
+{
+  RECEIVE_WAIT = 0,        ///< Angleset waiting for upstream angular fluxes
+  EXECUTE = 1,             ///< Angleset sweeping its cells
+  SEND = 2,                ///< Angleset sending downstream angular fluxes
+  DELAYED_DATA_RECEIVE = 3 ///< Location receiving delayed (cyclic) data after a sweep
+};
+
+/**
+ * Opt-in timeline tracer for sweeps. Events are recorded per angleset into a fixed-size ring
+ * buffer, so the oldest events are overwritten once the buffer is full, and are written per
+ * location as a Chrome trace (viewable in Perfetto or chrome://tracing) when the tracer is
+ * destroyed. Each angleset gets its own track. A per-sweep parallel efficiency, the total
+ * execution time over all locations divided by the number of locations and workers times the
+ * longest sweep time, is reduced over all locations at the end of each sweep.
+ *
+ * Events must only be recorded by the thread driving the sweep.
+ */
+class SweepTracer
+{
+public:
+  /**
+   * Creates a tracer writing to `<file_base>.<location id>.json`. Collective: all locations
+   * synchronize to align their clocks.
+   */
+  SweepTracer(const std::string& file_base, size_t capacity, int num_workers);
+
+  /// Writes the trace file.
+  ~SweepTracer();
+
+  SweepTracer(const SweepTracer&) = delete;
+  SweepTracer& operator=(const SweepTracer&) = delete;
+
+  /// Returns the current time, in nanoseconds since the tracer was created.
+  int64_t Now() const;
+
+  /// Marks the beginning of a sweep.
+  void BeginSweep();
+
+  /// Marks the end of a sweep and reduces its parallel efficiency. Collective.
+  void EndSweep();
+
+  /**
+   * Records an event spanning [begin, end], in nanoseconds from Now(). Events that are not tied
+   * to an angleset use an `angle_set_id` of -1.
+   */
+  void Record(SweepEventType type, int angle_set_id, int64_t begin, int64_t end);
+
+  /// Logs the parallel efficiency of the traced sweeps.
+  void LogSummary(const std::string& label) const;
+
+private:
+  struct Event
+  {
+    int64_t begin;
+    int64_t end;
+    int32_t angle_set_id;
+    uint32_t sweep;
+    SweepEventType type;
+  };
+
+  /// Per-sweep results, identical on all locations.
+  struct SweepSummary
+  {
+    /// Longest sweep time over all locations, in seconds.
+    double wall_time;
+    double efficiency;
+  };
+
+  void WriteChromeTrace() const;
+
+  const std::string file_name_;
+  const int num_workers_;
+  int64_t origin_ = 0;
+
+  std::vector<Event> events_;
+  size_t next_event_ = 0;
+  size_t num_events_ = 0;
+
+  uint32_t sweep_count_ = 0;
+  int64_t sweep_begin_ = 0;
+  int64_t sweep_execute_time_ = 0;
+  std::vector<SweepSummary> sweep_summaries_;
+};
+
+} // namespace opensn
@@ -5,15 +5,22 @@
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/logging/log.h"
 #include "framework/utils/timer.h"
+#include "framework/utils/utils.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
 #include <boost/graph/topological_sort.hpp>
 #include <algorithm>
+#include <set>
+#include <tuple>
 
 namespace opensn
 {
 
-AAH_SPDS::AAH_SPDS(int id, const Vector3& omega, const MeshContinuum& grid, bool allow_cycles)
+AAH_SPDS::AAH_SPDS(int id,
+                   const Vector3& omega,
+                   const MeshContinuum& grid,
+                   bool allow_cycles,
+                   bool gather_global_dependencies)
   : SPDS(omega, grid), id_(id), allow_cycles_(allow_cycles)
 {
   CALI_CXX_MARK_SCOPE("AAH_SPDS::AAH_SPDS");
@@ -60,8 +67,21 @@ AAH_SPDS::AAH_SPDS(int id, const Vector3& omega, const MeshContinuum& grid, bool
   }
 
   // Generate location-to-location dependencies
-  global_dependencies_.resize(opensn::mpi_comm.size());
-  CommunicateLocationDependencies(location_dependencies_, global_dependencies_);
+  if (gather_global_dependencies)
+  {
+    global_dependencies_.resize(opensn::mpi_comm.size());
+    CommunicateLocationDependencies(location_dependencies_, global_dependencies_);
+  }
+}
+
+size_t
+AAH_SPDS::MemoryUsage() const
+{
+  size_t bytes = SPDS::MemoryUsage() + VectorMemoryUsage(global_dependencies_) +
+                 VectorMemoryUsage(global_sweep_planes_) + VectorMemoryUsage(global_sweep_fas_);
+  for (const auto& plane : global_sweep_planes_)
+    bytes += VectorMemoryUsage(plane.item_id);
+  return bytes;
 }
 
 void
@@ -94,6 +114,8 @@ AAH_SPDS::BuildGlobalSweepFAS()
 void
 AAH_SPDS::BuildGlobalSweepTDG()
 {
+  assert(not global_dependencies_.empty());
+
   CALI_CXX_MARK_SCOPE("AAH_SPDS::BuildGlobalSweepTDG");
 
   // Create graph
@@ -186,6 +208,171 @@ AAH_SPDS::BuildGlobalSweepTDG()
         stdg.item_id.push_back(global_linear_sweep_order[k]);
     global_sweep_planes_.push_back(stdg);
   }
+
+  // Find location depth
+  for (size_t level = 0; level < global_sweep_planes_.size(); ++level)
+  {
+    const auto& plane = global_sweep_planes_[level].item_id;
+    if (std::find(plane.begin(), plane.end(), opensn::mpi_comm.rank()) != plane.end())
+    {
+      location_depth_ = static_cast<int>(global_sweep_planes_.size() - level);
+      break;
+    }
+  }
+
+  // The gathered dependencies are no longer needed
+  global_dependencies_.clear();
+  global_dependencies_.shrink_to_fit();
+}
+
+namespace
+{
+
+/// Exchanges equally sized arrays with every neighboring location.
+template <typename T>
+std::vector<std::vector<T>>
+ExchangeWithNeighbors(const std::vector<int>& neighbors, const std::vector<T>& send_data)
+{
+  constexpr int tag = 0;
+  const int count = static_cast<int>(send_data.size());
+
+  std::vector<std::vector<T>> recv_data(neighbors.size(), std::vector<T>(send_data.size()));
+  std::vector<mpi::Request> requests;
+  requests.reserve(2 * neighbors.size());
+  for (size_t i = 0; i < neighbors.size(); ++i)
+    requests.push_back(opensn::mpi_comm.irecv(neighbors[i], tag, recv_data[i].data(), count));
+  for (const int neighbor : neighbors)
+    requests.push_back(opensn::mpi_comm.isend(neighbor, tag, send_data));
+  mpi::wait_all(requests);
+
+  return recv_data;
+}
+
+} // namespace
+
+void
+AAH_SPDS::BuildDistributedSweepTDGs(std::vector<AAH_SPDS*> spds_list)
+{
+  CALI_CXX_MARK_SCOPE("AAH_SPDS::BuildDistributedSweepTDGs");
+
+  if (spds_list.empty())
+    return;
+
+  // Every location must process the SPDS in the same order. Container order is not guaranteed to
+  // be identical across locations, so sort on quantities that are.
+  std::sort(spds_list.begin(),
+            spds_list.end(),
+            [](const AAH_SPDS* a, const AAH_SPDS* b)
+            {
+              return std::tie(a->omega_.x, a->omega_.y, a->omega_.z, a->allow_cycles_, a->id_) <
+                     std::tie(b->omega_.x, b->omega_.y, b->omega_.z, b->allow_cycles_, b->id_);
+            });
+
+  const auto& grid = spds_list.front()->grid_;
+  const int rank = opensn::mpi_comm.rank();
+
+  // Determine neighboring locations and the centroid of this location
+  std::set<int> neighbor_set;
+  Vector3 centroid;
+  for (const auto& cell : grid.local_cells)
+  {
+    centroid += cell.centroid;
+    for (const auto& face : cell.faces)
+      if (face.has_neighbor and not grid.IsCellLocal(face.neighbor_id))
+        neighbor_set.insert(face.GetNeighborPartitionID(grid));
+  }
+  if (grid.local_cells.size() > 0)
+    centroid = centroid / static_cast<double>(grid.local_cells.size());
+
+  const std::vector<int> neighbors(neighbor_set.begin(), neighbor_set.end());
+  auto NeighborIndex = [&neighbors](int locJ)
+  { return std::lower_bound(neighbors.begin(), neighbors.end(), locJ) - neighbors.begin(); };
+
+  // Break location cycles by delaying edges that point upstream along omega. Both ends of an edge
+  // evaluate the same ordering on the same data, so they agree on which edges are delayed.
+  const std::vector<double> centroid_data = {centroid.x, centroid.y, centroid.z};
+  const auto neighbor_centroids = ExchangeWithNeighbors(neighbors, centroid_data);
+  for (auto* spds : spds_list)
+  {
+    if (not spds->allow_cycles_)
+      continue;
+
+    const auto& omega = spds->omega_;
+    auto SweepOrderKey = [&](int locJ)
+    {
+      if (locJ == rank)
+        return std::make_pair(omega.Dot(centroid), locJ);
+      const auto& c = neighbor_centroids[NeighborIndex(locJ)];
+      return std::make_pair(omega.Dot(Vector3(c[0], c[1], c[2])), locJ);
+    };
+    const auto this_key = SweepOrderKey(rank);
+
+    std::vector<int> location_dependencies;
+    for (const int locJ : spds->location_dependencies_)
+    {
+      if (SweepOrderKey(locJ) > this_key)
+        spds->delayed_location_dependencies_.push_back(locJ);
+      else
+        location_dependencies.push_back(locJ);
+    }
+    spds->location_dependencies_ = std::move(location_dependencies);
+
+    for (const int locJ : spds->location_successors_)
+      if (this_key > SweepOrderKey(locJ))
+        spds->delayed_location_successors_.push_back(locJ);
+  }
+
+  // Propagate levels from the sweep sources. Each round resolves the locations whose upwind
+  // locations are all resolved, so the number of rounds equals the number of sweep planes.
+  const size_t num_spds = spds_list.size();
+  std::vector<int> levels(num_spds, -1);
+  while (true)
+  {
+    const auto neighbor_levels = ExchangeWithNeighbors(neighbors, levels);
+
+    std::vector<int> counts(2, 0); // resolved this round, unresolved
+    for (size_t s = 0; s < num_spds; ++s)
+    {
+      if (levels[s] >= 0)
+        continue;
+
+      int max_upwind_level = -1;
+      bool ready = true;
+      for (const int locJ : spds_list[s]->location_dependencies_)
+      {
+        const int upwind_level = neighbor_levels[NeighborIndex(locJ)][s];
+        if (upwind_level < 0)
+        {
+          ready = false;
+          break;
+        }
+        max_upwind_level = std::max(max_upwind_level, upwind_level);
+      }
+
+      if (ready)
+      {
+        levels[s] = max_upwind_level + 1;
+        ++counts[0];
+      }
+      else
+        ++counts[1];
+    }
+
+    std::vector<int> global_counts(2, 0);
+    opensn::mpi_comm.all_reduce(counts, global_counts, mpi::op::sum<int>());
+    if (global_counts[1] == 0)
+      break;
+    if (global_counts[0] == 0)
+      throw std::logic_error("AAH_SPDS: Cyclic dependencies found in the global sweep graph.\n"
+                             "Cycles need to be allowed by the calling application.");
+  }
+
+  // The number of planes of each graph is the only global quantity needed
+  std::vector<int> max_levels(num_spds, 0);
+  opensn::mpi_comm.all_reduce(levels, max_levels, mpi::op::max<int>());
+
+  for (size_t s = 0; s < num_spds; ++s)
+    spds_list[s]->location_depth_ = max_levels[s] + 1 - levels[s];
 }
 
 } // namespace opensn
@@ -18,21 +18,50 @@ public:
    * \param omega The angular direction for the sweep operation.
    * \param grid The grid on which the sweep is performed.
    * \param allow_cycles Whether cycles are allowed in the local and global swepp dependency graphs.
+   * \param gather_global_dependencies Whether the location dependencies of all locations are
+   *        gathered on every location. Required by BuildGlobalSweepFAS and BuildGlobalSweepTDG, not
+   *        by BuildDistributedSweepTDGs.
    */
-  AAH_SPDS(int id, const Vector3& omega, const MeshContinuum& grid, bool allow_cycles);
+  AAH_SPDS(int id,
+           const Vector3& omega,
+           const MeshContinuum& grid,
+           bool allow_cycles,
+           bool gather_global_dependencies = true);
+
+  size_t MemoryUsage() const override;
 
   /// Returns the id of this SPDS.
   int Id() { return id_; }
 
-  /// Return the levelized global sweep TDG.
+  /// Return the levelized global sweep TDG. Only available after BuildGlobalSweepTDG.
   const std::vector<STDG>& GlobalSweepPlanes() const { return global_sweep_planes_; }
 
+  /**
+   * Returns the depth of this location in the levelized global sweep TDG, i.e. the number of
+   * sweep planes from this location's plane to the end of the sweep. Locations that sweep first
+   * have the largest depth.
+   */
+  int LocationDepth() const { return location_depth_; }
+
   /// Builds the Feedback Arc Set (FAS) for the global sweep.
   void BuildGlobalSweepFAS();
 
   /// Builds the Task Dependency Graph (TDG) for the global sweep.
   void BuildGlobalSweepTDG();
 
+  /**
+   * Levelizes the location graphs of several SPDS using only communication with neighboring
+   * locations, instead of gathering every location's dependencies everywhere. Levels propagate
+   * from the sweep sources in rounds of neighbor exchanges, followed by a single reduction for the
+   * number of levels, so memory is independent of the number of locations.
+   *
+   * If cycles are allowed, location cycles are broken without a global feedback arc set: an edge
+   * is delayed when its upwind location lies further downstream, measured by the projection of
+   * the location centroids onto the sweep direction. This delays every such edge, whether or not
+   * it is part of a cycle. Must be called collectively with the same SPDS on all locations.
+   */
+  static void BuildDistributedSweepTDGs(std::vector<AAH_SPDS*> spds_list);
+
   /// Returns the global sweep FAS as a vector of edges.
   std::vector<int> GlobalSweepFAS() { return global_sweep_fas_; }
 
@@ -51,6 +80,8 @@ private:
   std::vector<std::vector<int>> global_dependencies_;
   /// Levelized global sweep task dependency graph.
   std::vector<STDG> global_sweep_planes_;
+  /// Depth of this location in the levelized sweep graph.
+  int location_depth_ = -1;
   /// Vector of edges representing the FAS used to break cycles in the global sweep graph.
   std::vector<int> global_sweep_fas_;
 };
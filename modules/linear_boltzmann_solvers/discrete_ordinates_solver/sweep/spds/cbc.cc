@@ -5,6 +5,7 @@
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/logging/log.h"
 #include "framework/utils/timer.h"
+#include "framework/utils/utils.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
 #include <boost/graph/topological_sort.hpp>
@@ -61,10 +62,6 @@ CBC_SPDS::CBC_SPDS(const Vector3& omega, const MeshContinuum& grid, bool allow_c
   }
 
   // Create task list
-  std::vector<std::vector<int>> global_dependencies;
-  global_dependencies.resize(opensn::mpi_comm.size());
-  CommunicateLocationDependencies(location_dependencies_, global_dependencies);
-
   constexpr auto INCOMING = FaceOrientation::INCOMING;
   constexpr auto OUTGOING = FaceOrientation::OUTGOING;
 
@@ -74,6 +71,7 @@ CBC_SPDS::CBC_SPDS(const Vector3& omega, const MeshContinuum& grid, bool allow_c
     const size_t num_faces = cell.faces.size();
     unsigned int num_dependencies = 0;
     std::vector<uint64_t> succesors;
+    bool has_remote_successors = false;
 
     for (size_t f = 0; f < num_faces; ++f)
     {
@@ -87,10 +85,13 @@ CBC_SPDS::CBC_SPDS(const Vector3& omega, const MeshContinuum& grid, bool allow_c
         const auto& face = cell.faces[f];
         if (face.has_neighbor and grid.IsCellLocal(face.neighbor_id))
           succesors.push_back(grid.cells[face.neighbor_id].local_id);
+        else if (face.has_neighbor)
+          has_remote_successors = true;
       }
     }
 
-    task_list_.push_back({num_dependencies, succesors, cell.local_id, &cell, false});
+    task_list_.push_back(
+      {num_dependencies, succesors, cell.local_id, &cell, has_remote_successors});
   }
 }
 
@@ -100,4 +101,13 @@ CBC_SPDS::TaskList() const
   return task_list_;
 }
 
+size_t
+CBC_SPDS::MemoryUsage() const
+{
+  size_t bytes = SPDS::MemoryUsage() + VectorMemoryUsage(task_list_);
+  for (const auto& task : task_list_)
+    bytes += VectorMemoryUsage(task.successors);
+  return bytes;
+}
+
 } // namespace opensn
@@ -24,6 +24,8 @@ public:
   /// Returns the cell-by-cell task list.
   const std::vector<Task>& TaskList() const;
 
+  size_t MemoryUsage() const override;
+
 protected:
   /// Cell-by-cell task list.
   std::vector<Task> task_list_;
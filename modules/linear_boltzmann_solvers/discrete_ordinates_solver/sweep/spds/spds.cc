@@ -5,6 +5,7 @@
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/logging/log.h"
 #include "framework/utils/timer.h"
+#include "framework/utils/utils.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
 #include <boost/graph/adjacency_list.hpp>
@@ -15,6 +16,72 @@
 namespace opensn
 {
 
+FaceOrientationNormals::FaceOrientationNormals(const MeshContinuum& grid)
+{
+  for (const auto& cell : grid.local_cells)
+  {
+    for (const auto& face : cell.faces)
+    {
+      if (not face.has_neighbor or cell.global_id < face.neighbor_id)
+      {
+        normals_.push_back(face.normal);
+        reversed_.push_back(false);
+      }
+      else
+      {
+        const auto& adj_cell = grid.cells[face.neighbor_id];
+        normals_.push_back(adj_cell.faces[face.GetNeighborAssociatedFace(grid)].normal);
+        reversed_.push_back(true);
+      }
+    }
+  }
+}
+
+FaceOrientation
+FaceOrientationNormals::Orientation(const Vector3& omega, size_t i) const
+{
+  constexpr double tolerance = 1.0e-16;
+
+  const double mu = omega.Dot(normals_[i]);
+  if (mu > tolerance)
+    return reversed_[i] ? FaceOrientation::INCOMING : FaceOrientation::OUTGOING;
+  else if (mu < tolerance)
+    return reversed_[i] ? FaceOrientation::OUTGOING : FaceOrientation::INCOMING;
+  return FaceOrientation::PARALLEL;
+}
+
+uint64_t
+FaceOrientationNormals::Hash(const Vector3& omega) const
+{
+  // 64-bit FNV-1a over the orientation of every local face
+  uint64_t hash = 14695981039346656037ull;
+  for (size_t i = 0; i < normals_.size(); ++i)
+  {
+    hash ^= static_cast<uint64_t>(static_cast<short>(Orientation(omega, i)) + 1);
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+bool
+FaceOrientationNormals::SameOrientations(const Vector3& omega_a, const Vector3& omega_b) const
+{
+  for (size_t i = 0; i < normals_.size(); ++i)
+    if (Orientation(omega_a, i) != Orientation(omega_b, i))
+      return false;
+  return true;
+}
+
+size_t
+SPDS::MemoryUsage() const
+{
+  return VectorMemoryUsage(spls_.item_id) + VectorMemoryUsage(location_dependencies_) +
+         VectorMemoryUsage(location_successors_) +
+         VectorMemoryUsage(delayed_location_dependencies_) +
+         VectorMemoryUsage(delayed_location_successors_) + VectorMemoryUsage(local_sweep_fas_) +
+         VectorMemoryUsage(cell_face_orientations_);
+}
+
 std::vector<std::pair<int, int>>
 SPDS::FindApproxMinimumFAS(Graph& g, std::vector<Vertex>& scc_vertices)
 {
@@ -331,88 +398,17 @@ SPDS::PopulateCellRelationships(const Vector3& omega,
 {
   CALI_CXX_MARK_SCOPE("SPDS::PopulateCellRelationships");
 
-  constexpr double tolerance = 1.0e-16;
-
-  constexpr auto FOPARALLEL = FaceOrientation::PARALLEL;
-  constexpr auto FOINCOMING = FaceOrientation::INCOMING;
   constexpr auto FOOUTGOING = FaceOrientation::OUTGOING;
 
+  const FaceOrientationNormals face_normals(grid_);
   cell_face_orientations_.assign(grid_.local_cells.size(), {});
-  for (auto& cell : grid_.local_cells)
-    cell_face_orientations_[cell.local_id].assign(cell.faces.size(), FOPARALLEL);
-
+  size_t i = 0;
   for (auto& cell : grid_.local_cells)
   {
-    size_t f = 0;
-    for (auto& face : cell.faces)
-    {
-      // Determine if the face is incident
-      FaceOrientation orientation = FOPARALLEL;
-      const double mu = omega.Dot(face.normal);
-
-      bool owns_face = true;
-      if (face.has_neighbor and cell.global_id > face.neighbor_id)
-        owns_face = false;
-
-      if (owns_face)
-      {
-        if (mu > tolerance)
-          orientation = FOOUTGOING;
-        else if (mu < tolerance)
-          orientation = FOINCOMING;
-
-        cell_face_orientations_[cell.local_id][f] = orientation;
-
-        if (face.has_neighbor and grid_.IsCellLocal(face.neighbor_id))
-        {
-          const auto& adj_cell = grid_.cells[face.neighbor_id];
-          const auto ass_face = face.GetNeighborAssociatedFace(grid_);
-          auto& adj_face_ori = cell_face_orientations_[adj_cell.local_id][ass_face];
-
-          switch (orientation)
-          {
-            case FOPARALLEL:
-              adj_face_ori = FOPARALLEL;
-              break;
-            case FOINCOMING:
-              adj_face_ori = FOOUTGOING;
-              break;
-            case FOOUTGOING:
-              adj_face_ori = FOINCOMING;
-              break;
-          }
-        }
-      } // if face owned
-      else if (face.has_neighbor and not grid_.IsCellLocal(face.neighbor_id))
-      {
-        const auto& adj_cell = grid_.cells[face.neighbor_id];
-        const auto ass_face = face.GetNeighborAssociatedFace(grid_);
-        const auto& adj_face = adj_cell.faces[ass_face];
-
-        auto& cur_face_ori = cell_face_orientations_[cell.local_id][f];
-
-        const double adj_mu = omega.Dot(adj_face.normal);
-        if (adj_mu > tolerance)
-          orientation = FOOUTGOING;
-        else if (adj_mu < tolerance)
-          orientation = FOINCOMING;
-
-        switch (orientation)
-        {
-          case FOPARALLEL:
-            cur_face_ori = FOPARALLEL;
-            break;
-          case FOINCOMING:
-            cur_face_ori = FOOUTGOING;
-            break;
-          case FOOUTGOING:
-            cur_face_ori = FOINCOMING;
-            break;
-        }
-      } // if not face owned locally at all
-
-      ++f;
-    } // for face
+    auto& orientations = cell_face_orientations_[cell.local_id];
+    orientations.reserve(cell.faces.size());
+    for (size_t f = 0; f < cell.faces.size(); ++f)
+      orientations.push_back(face_normals.Orientation(omega, i++));
   }
 
   // Make directed connections
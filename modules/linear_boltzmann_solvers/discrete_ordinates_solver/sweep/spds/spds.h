@@ -23,6 +23,34 @@ using Graph = boost::adjacency_list<boost::vecS,
                                     boost::property<boost::edge_weight_t, double>>;
 using Vertex = boost::graph_traits<Graph>::vertex_descriptor;
 
+/**
+ * The normals that decide the orientation of the local cell faces with respect to a direction,
+ * flattened in cell and face order. An interior face is oriented by the cell with the lower global
+ * id, using that cell's normal, so that both sides of the face always agree.
+ */
+class FaceOrientationNormals
+{
+public:
+  explicit FaceOrientationNormals(const MeshContinuum& grid);
+
+  /// Returns the orientation of local face `i` with respect to `omega`.
+  FaceOrientation Orientation(const Vector3& omega, size_t i) const;
+
+  /**
+   * Returns a hash of the orientations of all local faces with respect to `omega`. Directions
+   * with identical face orientations on every location have identical sweep graphs.
+   */
+  uint64_t Hash(const Vector3& omega) const;
+
+  /// Returns true if two directions induce the same orientation on every local face.
+  bool SameOrientations(const Vector3& omega_a, const Vector3& omega_b) const;
+
+private:
+  std::vector<Vector3> normals_;
+  /// Whether a normal is the neighbor cell's, which reverses the orientation.
+  std::vector<bool> reversed_;
+};
+
 class SPDS
 {
 public:
@@ -67,6 +95,9 @@ public:
     return cell_face_orientations_;
   }
 
+  /// Returns an estimate of the memory, in bytes, held by this SPDS.
+  virtual size_t MemoryUsage() const;
+
   /**
    * Removes cyclic dependencies from the given graph.
    *
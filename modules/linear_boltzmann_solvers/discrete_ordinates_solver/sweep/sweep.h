@@ -35,7 +35,8 @@ struct Task
   std::vector<uint64_t> successors;
   uint64_t reference_id;
   const Cell* cell_ptr;
-  bool completed = false;
+  /// True if the cell has an outgoing face whose neighbor lives on another location.
+  bool has_remote_successors = false;
 };
 
 /**
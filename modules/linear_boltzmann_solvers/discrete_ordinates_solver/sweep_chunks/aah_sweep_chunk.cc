@@ -4,14 +4,45 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/aah_sweep_chunk.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/aah_fluds.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/logging/log.h"
 #include "caliper/cali.h"
+#include <algorithm>
+#include <array>
 
 namespace opensn
 {
 
+struct AahSweepChunk::SweepWorkspace
+{
+  AngleSet& angle_set;
+  AAH_FLUDS& fluds;
+  const SPDS& spds;
+  const std::vector<int>& spls;
+  const std::vector<std::vector<double>>& m2d_op;
+  const std::vector<std::vector<double>>& d2m_op;
+  const size_t gs_ss_size;
+  const size_t gs_ss_begin;
+  const int gs_gi;
+  const size_t angle_block_size;
+
+  int deploc_face_counter = -1;
+  int preloc_face_counter = -1;
+
+  // The systems of an angle block are stored lane-innermost, with lane = angle * gs_ss_size +
+  // gsg: Atemp[(i * n + j) * num_lanes + lane] and b[i * num_lanes + lane]. All angles and groups
+  // of a block are solved in one batched pass.
+  std::vector<double> Amat;
+  std::vector<double> Atemp;
+  std::vector<double> b;
+  std::vector<double> source;
+  std::vector<double> q_moms;
+  std::vector<double> sigma_tg;
+  std::vector<double> face_mu_values;
+};
+
 AahSweepChunk::AahSweepChunk(const MeshContinuum& grid,
                              const SpatialDiscretization& discretization,
-                             const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                             const UnitCellMatricesPool& unit_cell_matrices,
                              std::vector<CellLBSView>& cell_transport_views,
                              const std::vector<double>& densities,
                              std::vector<double>& destination_phi,
@@ -20,7 +51,9 @@ AahSweepChunk::AahSweepChunk(const MeshContinuum& grid,
                              const LBSGroupset& groupset,
                              const std::map<int, std::shared_ptr<MultiGroupXS>>& xs,
                              int num_moments,
-                             int max_num_cell_dofs)
+                             int max_num_cell_dofs,
+                             bool pack_cell_matrices,
+                             size_t angle_block_size)
   : SweepChunk(destination_phi,
                destination_psi,
                grid,
@@ -32,82 +65,395 @@ AahSweepChunk::AahSweepChunk(const MeshContinuum& grid,
                groupset,
                xs,
                num_moments,
-               max_num_cell_dofs)
+               max_num_cell_dofs),
+    angle_block_size_(std::max<size_t>(angle_block_size, 1))
 {
+  // Select the cell kernels and flatten the face node maps
+  cell_sweep_info_.resize(grid_.local_cells.size());
+  for (const auto& cell : grid_.local_cells)
+  {
+    const auto& cell_mapping = discretization_.GetCellMapping(cell);
+    const size_t num_nodes = cell_mapping.NumNodes();
+    const size_t num_faces = cell.faces.size();
+    auto& info = cell_sweep_info_[cell.local_id];
+
+    if ((cell.SubType() == CellType::SLAB and num_nodes == 2) or
+        (cell.SubType() == CellType::QUADRILATERAL and num_nodes == 4) or
+        (cell.SubType() == CellType::HEXAHEDRON and num_nodes == 8))
+      info.kernel_num_nodes = num_nodes;
+    info.num_nodes = num_nodes;
+
+    info.face_node_offsets.assign(1, 0);
+    info.face_matrix_offsets.assign(1, 0);
+    for (size_t f = 0; f < num_faces; ++f)
+    {
+      const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+      for (size_t fi = 0; fi < num_face_nodes; ++fi)
+        info.face_nodes.push_back(cell_mapping.MapFaceNode(f, fi));
+      info.face_node_offsets.push_back(static_cast<int>(info.face_nodes.size()));
+      info.face_matrix_offsets.push_back(info.face_matrix_offsets.back() +
+                                         static_cast<int>(num_face_nodes * num_face_nodes));
+    }
+    info.packed_size = 4 * num_nodes * num_nodes + 3 * num_faces +
+                       info.face_matrix_offsets.back() + info.face_nodes.size();
+
+    max_num_cell_faces_ = std::max(max_num_cell_faces_, num_faces);
+  }
+
+  if (pack_cell_matrices)
+    BuildCellMatrixArenas();
 }
 
+void
+AahSweepChunk::PackCellMatrices(const Cell& cell, double* block) const
+{
+  const auto& info = cell_sweep_info_[cell.local_id];
+  const auto& matrices = unit_cell_matrices_[cell.local_id];
+  const size_t n2 = info.num_nodes * info.num_nodes;
+  const size_t num_faces = cell.faces.size();
+
+  const Vector3* G = matrices.intV_shapeI_gradshapeJ.data();
+  const double* M = matrices.intV_shapeI_shapeJ.data();
+  for (size_t ij = 0; ij < n2; ++ij)
+  {
+    block[ij] = G[ij].x;
+    block[n2 + ij] = G[ij].y;
+    block[2 * n2 + ij] = G[ij].z;
+    block[3 * n2 + ij] = M[ij];
+  }
+
+  double* normals = block + 4 * n2;
+  for (size_t f = 0; f < num_faces; ++f)
+  {
+    normals[f] = cell.faces[f].normal.x;
+    normals[num_faces + f] = cell.faces[f].normal.y;
+    normals[2 * num_faces + f] = cell.faces[f].normal.z;
+  }
+
+  double* face_matrices = normals + 3 * num_faces;
+  double* face_shapes = face_matrices + info.face_matrix_offsets.back();
+  for (size_t f = 0; f < num_faces; ++f)
+  {
+    const int* face_nodes = &info.face_nodes[info.face_node_offsets[f]];
+    const int num_face_nodes = info.face_node_offsets[f + 1] - info.face_node_offsets[f];
+    double* face_matrix = face_matrices + info.face_matrix_offsets[f];
+    for (int fi = 0; fi < num_face_nodes; ++fi)
+    {
+      for (int fj = 0; fj < num_face_nodes; ++fj)
+        face_matrix[fi * num_face_nodes + fj] =
+          matrices.intS_shapeI_shapeJ[f](face_nodes[fi], face_nodes[fj]);
+      face_shapes[info.face_node_offsets[f] + fi] = matrices.intS_shapeI[f](face_nodes[fi]);
+    }
+  }
+}
+
+void
+AahSweepChunk::BuildCellMatrixArenas()
+{
+  CALI_CXX_MARK_SCOPE("AahSweepChunk::BuildCellMatrixArenas");
+
+  size_t arena_bytes = 0;
+  for (auto& angle_set_group : groupset_.angle_agg->angle_set_groups)
+    for (auto& angle_set : angle_set_group.AngleSets())
+    {
+      const auto& spds = angle_set->GetSPDS();
+      if (cell_matrix_arenas_.count(&spds) > 0)
+        continue;
+
+      auto& arena = cell_matrix_arenas_[&spds];
+      const auto& spls = spds.LocalSubgrid().item_id;
+      arena.offsets.resize(spls.size());
+      size_t arena_size = 0;
+      for (size_t spls_index = 0; spls_index < spls.size(); ++spls_index)
+      {
+        arena.offsets[spls_index] = arena_size;
+        arena_size += cell_sweep_info_[spls[spls_index]].packed_size;
+      }
+
+      arena.data.resize(arena_size);
+      for (size_t spls_index = 0; spls_index < spls.size(); ++spls_index)
+        PackCellMatrices(grid_.local_cells[spls[spls_index]],
+                         &arena.data[arena.offsets[spls_index]]);
+
+      arena_bytes += arena_size * sizeof(double) + spls.size() * sizeof(size_t);
+    }
+
+  log.Log0Verbose1() << "Groupset " << groupset_.id << ": packed cell matrices for "
+                     << cell_matrix_arenas_.size() << " sweep orderings use "
+                     << static_cast<double>(arena_bytes) / 1048576.0 << " MB on location 0.";
+}
+
+template <unsigned int NumNodes>
+class AahSweepChunk::UnitCellMatricesView
+{
+public:
+  UnitCellMatricesView(const UnitCellMatrices& matrices,
+                       const Cell& cell,
+                       const CellSweepInfo& info,
+                       const double* packed_block)
+    : matrices_(matrices),
+      cell_(cell),
+      G_(matrices.intV_shapeI_gradshapeJ.data()),
+      M_(matrices.intV_shapeI_shapeJ.data())
+  {
+    // The specialized kernels work on fixed-size local copies
+    if constexpr (NumNodes > 0)
+    {
+      std::copy_n(G_, NumNodes * NumNodes, G_fixed_.begin());
+      std::copy_n(M_, NumNodes * NumNodes, M_fixed_.begin());
+      G_ = G_fixed_.data();
+      M_ = M_fixed_.data();
+    }
+  }
+
+  /// Computes Amat(i, j) = omega . G(i, j).
+  void StreamingMatrix(const Vector3& omega, unsigned int num_nodes, double* Amat) const
+  {
+    for (unsigned int ij = 0; ij < num_nodes * num_nodes; ++ij)
+      Amat[ij] = omega.Dot(G_[ij]);
+  }
+
+  double FaceMu(const Vector3& omega, int f) const { return omega.Dot(cell_.faces[f].normal); }
+
+  const double* MassMatrix() const { return M_; }
+
+  double FaceMassMatrix(int f, int fi, int fj, int i, int j) const
+  {
+    return matrices_.intS_shapeI_shapeJ[f](i, j);
+  }
+
+  double FaceShape(int f, int fi, int i) const { return matrices_.intS_shapeI[f](i); }
+
+private:
+  static constexpr size_t fixed_size_ = (NumNodes > 0) ? NumNodes * NumNodes : 1;
+
+  const UnitCellMatrices& matrices_;
+  const Cell& cell_;
+  const Vector3* G_;
+  const double* M_;
+  std::array<Vector3, fixed_size_> G_fixed_;
+  std::array<double, fixed_size_> M_fixed_;
+};
+
+template <unsigned int NumNodes>
+class AahSweepChunk::PackedCellMatricesView
+{
+public:
+  PackedCellMatricesView(const UnitCellMatrices& matrices,
+                         const Cell& cell,
+                         const CellSweepInfo& info,
+                         const double* packed_block)
+    : info_(info)
+  {
+    const size_t n = (NumNodes > 0) ? NumNodes : info.num_nodes;
+    const size_t num_faces = cell.faces.size();
+    Gx_ = packed_block;
+    Gy_ = Gx_ + n * n;
+    Gz_ = Gy_ + n * n;
+    M_ = Gz_ + n * n;
+    Nx_ = M_ + n * n;
+    Ny_ = Nx_ + num_faces;
+    Nz_ = Ny_ + num_faces;
+    face_matrices_ = Nz_ + num_faces;
+    face_shapes_ = face_matrices_ + info.face_matrix_offsets.back();
+  }
+
+  /// Computes Amat(i, j) = omega . G(i, j).
+  void StreamingMatrix(const Vector3& omega, unsigned int num_nodes, double* Amat) const
+  {
+    for (unsigned int ij = 0; ij < num_nodes * num_nodes; ++ij)
+      Amat[ij] = omega.x * Gx_[ij] + omega.y * Gy_[ij] + omega.z * Gz_[ij];
+  }
+
+  double FaceMu(const Vector3& omega, int f) const
+  {
+    return omega.x * Nx_[f] + omega.y * Ny_[f] + omega.z * Nz_[f];
+  }
+
+  const double* MassMatrix() const { return M_; }
+
+  double FaceMassMatrix(int f, int fi, int fj, int i, int j) const
+  {
+    const int num_face_nodes = info_.face_node_offsets[f + 1] - info_.face_node_offsets[f];
+    return face_matrices_[info_.face_matrix_offsets[f] + fi * num_face_nodes + fj];
+  }
+
+  double FaceShape(int f, int fi, int i) const
+  {
+    return face_shapes_[info_.face_node_offsets[f] + fi];
+  }
+
+private:
+  const CellSweepInfo& info_;
+  const double* Gx_;
+  const double* Gy_;
+  const double* Gz_;
+  const double* M_;
+  const double* Nx_;
+  const double* Ny_;
+  const double* Nz_;
+  const double* face_matrices_;
+  const double* face_shapes_;
+};
+
 void
 AahSweepChunk::Sweep(AngleSet& angle_set)
 {
   CALI_CXX_MARK_SCOPE("AahSweepChunk::Sweep");
 
   const SubSetInfo& grp_ss_info = groupset_.grp_subset_infos[angle_set.GetGroupSubset()];
+  const auto gs_ss_size = grp_ss_info.ss_size;
+  const auto gs_ss_begin = grp_ss_info.ss_begin;
+  const auto& spds = angle_set.GetSPDS();
 
-  auto gs_ss_size = grp_ss_info.ss_size;
-  auto gs_ss_begin = grp_ss_info.ss_begin;
-  auto gs_gi = groupset_.groups[gs_ss_begin].id;
+  SweepWorkspace ws{angle_set,
+                    dynamic_cast<AAH_FLUDS&>(angle_set.GetFLUDS()),
+                    spds,
+                    spds.LocalSubgrid().item_id,
+                    groupset_.quadrature->GetMomentToDiscreteOperator(),
+                    groupset_.quadrature->GetDiscreteToMomentOperator(),
+                    gs_ss_size,
+                    gs_ss_begin,
+                    groupset_.groups[gs_ss_begin].id,
+                    std::min(angle_block_size_, angle_set.GetNumAngles())};
+
+  const size_t max_nodes = max_num_cell_dofs_;
+  const size_t max_lanes = ws.angle_block_size * gs_ss_size;
+  ws.Amat.resize(max_nodes * max_nodes);
+  ws.Atemp.resize(max_nodes * max_nodes * max_lanes);
+  ws.b.resize(max_nodes * max_lanes);
+  ws.source.resize(max_nodes * max_lanes);
+  ws.q_moms.resize(max_nodes * num_moments_ * gs_ss_size);
+  ws.sigma_tg.resize(gs_ss_size);
+  ws.face_mu_values.resize(max_num_cell_faces_);
 
-  int deploc_face_counter = -1;
-  int preloc_face_counter = -1;
-
-  auto& fluds = dynamic_cast<AAH_FLUDS&>(angle_set.GetFLUDS());
-  const auto& m2d_op = groupset_.quadrature->GetMomentToDiscreteOperator();
-  const auto& d2m_op = groupset_.quadrature->GetDiscreteToMomentOperator();
+  // Loop over each cell
+  const size_t num_spls = ws.spls.size();
+  const auto arena_it = cell_matrix_arenas_.find(&spds);
+  if (arena_it != cell_matrix_arenas_.end())
+  {
+    const auto& arena = arena_it->second;
+    for (size_t spls_index = 0; spls_index < num_spls; ++spls_index)
+      DispatchCell<PackedCellMatricesView>(
+        ws, spls_index, &arena.data[arena.offsets[spls_index]]);
+  }
+  else
+  {
+    for (size_t spls_index = 0; spls_index < num_spls; ++spls_index)
+      DispatchCell<UnitCellMatricesView>(ws, spls_index, nullptr);
+  }
+}
 
-  DenseMatrix<double> Amat(max_num_cell_dofs_, max_num_cell_dofs_);
-  DenseMatrix<double> Atemp(max_num_cell_dofs_, max_num_cell_dofs_);
-  std::vector<Vector<double>> b(groupset_.groups.size(), Vector<double>(max_num_cell_dofs_, 0.));
-  std::vector<double> source(max_num_cell_dofs_);
+template <template <unsigned int> class MatricesView>
+void
+AahSweepChunk::DispatchCell(SweepWorkspace& ws, size_t spls_index, const double* packed_block)
+{
+  switch (cell_sweep_info_[ws.spls[spls_index]].kernel_num_nodes)
+  {
+    case 2:
+      SweepCell<2, MatricesView<2>>(ws, spls_index, packed_block);
+      break;
+    case 4:
+      SweepCell<4, MatricesView<4>>(ws, spls_index, packed_block);
+      break;
+    case 8:
+      SweepCell<8, MatricesView<8>>(ws, spls_index, packed_block);
+      break;
+    default:
+      SweepCell<0, MatricesView<0>>(ws, spls_index, packed_block);
+  }
+}
 
-  // Loop over each cell
-  const auto& spds = angle_set.GetSPDS();
-  const auto& spls = spds.LocalSubgrid().item_id;
-  const size_t num_spls = spls.size();
-  for (size_t spls_index = 0; spls_index < num_spls; ++spls_index)
+template <unsigned int NumNodes, class MatricesView>
+void
+AahSweepChunk::SweepCell(SweepWorkspace& ws, size_t spls_index, const double* packed_block)
+{
+  auto& angle_set = ws.angle_set;
+  auto& fluds = ws.fluds;
+  const auto gs_ss_size = ws.gs_ss_size;
+  const auto gs_ss_begin = ws.gs_ss_begin;
+  const auto gs_gi = ws.gs_gi;
+  auto& b = ws.b;
+  auto& source = ws.source;
+  auto& Atemp = ws.Atemp;
+  auto& face_mu_values = ws.face_mu_values;
+
+  const auto cell_local_id = ws.spls[spls_index];
+  const auto& cell = grid_.local_cells[cell_local_id];
+  auto& cell_transport_view = cell_transport_views_[cell_local_id];
+  const auto& info = cell_sweep_info_[cell_local_id];
+  const size_t cell_num_faces = cell.faces.size();
+  const unsigned int cell_num_nodes =
+    (NumNodes > 0) ? NumNodes : static_cast<unsigned int>(cell_transport_view.NumNodes());
+
+  const auto& face_orientations = ws.spds.CellFaceOrientations()[cell_local_id];
+
+  const auto& rho = densities_[cell.local_id];
+  const auto& sigma_t = xs_.at(cell.material_id)->SigmaTotal();
+  for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+    ws.sigma_tg[gsg] = rho * sigma_t[gs_gi + gsg];
+
+  // Get cell matrices
+  const auto& unit_matrices = unit_cell_matrices_[cell_local_id];
+  const MatricesView matrices(unit_matrices, cell, info, packed_block);
+  const double* M = matrices.MassMatrix();
+
+  std::array<double, (NumNodes > 0) ? NumNodes * NumNodes : 1> Amat_fixed;
+  double* Amat = (NumNodes > 0) ? Amat_fixed.data() : ws.Amat.data();
+
+  // Gather the source moments of the cell once, q_moms[(i * num_moments + m) * gs_ss_size + gsg]
+  for (int i = 0; i < cell_num_nodes; ++i)
+    for (int m = 0; m < num_moments_; ++m)
+    {
+      const double* q = &source_moments_[cell_transport_view.MapDOF(i, m, gs_gi)];
+      std::copy_n(q, gs_ss_size, &ws.q_moms[(i * num_moments_ + m) * gs_ss_size]);
+    }
+
+  // Loop over blocks of angles in set (as = angleset, ss = subset). All systems of a block are
+  // stored with lane index as_ss_blk * gs_ss_size + gsg and solved together.
+  const int ni_deploc_face_counter = ws.deploc_face_counter;
+  const int ni_preloc_face_counter = ws.preloc_face_counter;
+  const std::vector<size_t>& as_angle_indices = angle_set.GetAngleIndices();
+  const size_t num_angles = as_angle_indices.size();
+  for (size_t block_begin = 0; block_begin < num_angles; block_begin += ws.angle_block_size)
   {
-    auto cell_local_id = spls[spls_index];
-    auto& cell = grid_.local_cells[cell_local_id];
-    auto& cell_mapping = discretization_.GetCellMapping(cell);
-    auto& cell_transport_view = cell_transport_views_[cell_local_id];
-    auto cell_num_faces = cell.faces.size();
-    auto cell_num_nodes = cell_mapping.NumNodes();
-
-    const auto& face_orientations = spds.CellFaceOrientations()[cell_local_id];
-    std::vector<double> face_mu_values(cell_num_faces);
-
-    const auto& rho = densities_[cell.local_id];
-    const auto& sigma_t = xs_.at(cell.material_id)->SigmaTotal();
-
-    // Get cell matrices
-    const auto& G = unit_cell_matrices_[cell_local_id].intV_shapeI_gradshapeJ;
-    const auto& M = unit_cell_matrices_[cell_local_id].intV_shapeI_shapeJ;
-    const auto& M_surf = unit_cell_matrices_[cell_local_id].intS_shapeI_shapeJ;
-
-    // Loop over angles in set (as = angleset, ss = subset)
-    const int ni_deploc_face_counter = deploc_face_counter;
-    const int ni_preloc_face_counter = preloc_face_counter;
-    const std::vector<size_t>& as_angle_indices = angle_set.GetAngleIndices();
-    for (size_t as_ss_idx = 0; as_ss_idx < as_angle_indices.size(); ++as_ss_idx)
+    const size_t block_size = std::min(ws.angle_block_size, num_angles - block_begin);
+    const size_t num_lanes = block_size * gs_ss_size;
+
+    // Contribute source moments q = M_n^T * q_moms for all angles of the block
+    for (int i = 0; i < cell_num_nodes; ++i)
+      for (size_t as_ss_blk = 0; as_ss_blk < block_size; ++as_ss_blk)
+      {
+        const auto direction_num = as_angle_indices[block_begin + as_ss_blk];
+        double* source_i = &source[i * num_lanes + as_ss_blk * gs_ss_size];
+        std::fill_n(source_i, gs_ss_size, 0.0);
+        for (int m = 0; m < num_moments_; ++m)
+        {
+          const double m2d = ws.m2d_op[m][direction_num];
+          const double* q = &ws.q_moms[(i * num_moments_ + m) * gs_ss_size];
+          for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+            source_i[gsg] += m2d * q[gsg];
+        }
+      }
+
+    // Reset right-hand side
+    std::fill_n(b.begin(), cell_num_nodes * num_lanes, 0.0);
+
+    // Assemble the systems of the block
+    for (size_t as_ss_blk = 0; as_ss_blk < block_size; ++as_ss_blk)
     {
+      const size_t as_ss_idx = block_begin + as_ss_blk;
       auto direction_num = as_angle_indices[as_ss_idx];
       auto omega = groupset_.quadrature->omegas[direction_num];
-      auto wt = groupset_.quadrature->weights[direction_num];
+      double* b_angle = &b[as_ss_blk * gs_ss_size];
 
-      deploc_face_counter = ni_deploc_face_counter;
-      preloc_face_counter = ni_preloc_face_counter;
+      ws.preloc_face_counter = ni_preloc_face_counter;
 
-      // Reset right-hand side
-      for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-        for (int i = 0; i < cell_num_nodes; ++i)
-          b[gsg](i) = 0.0;
-
-      for (int i = 0; i < cell_num_nodes; ++i)
-        for (int j = 0; j < cell_num_nodes; ++j)
-          Amat(i, j) = omega.Dot(G(i, j));
+      matrices.StreamingMatrix(omega, cell_num_nodes, Amat);
 
       // Update face orientations
       for (int f = 0; f < cell_num_faces; ++f)
-        face_mu_values[f] = omega.Dot(cell.faces[f].normal);
+        face_mu_values[f] = matrices.FaceMu(omega, f);
 
       // Surface integrals
       int in_face_counter = -1;
@@ -123,94 +469,105 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
         if (is_local_face)
           ++in_face_counter;
         else if (not is_boundary_face)
-          ++preloc_face_counter;
+          ++ws.preloc_face_counter;
 
         // IntSf_mu_psi_Mij_dA
-        const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+        const int* face_nodes = &info.face_nodes[info.face_node_offsets[f]];
+        const int num_face_nodes = info.face_node_offsets[f + 1] - info.face_node_offsets[f];
         for (int fi = 0; fi < num_face_nodes; ++fi)
         {
-          const int i = cell_mapping.MapFaceNode(f, fi);
+          const int i = face_nodes[fi];
 
           for (int fj = 0; fj < num_face_nodes; ++fj)
           {
-            const int j = cell_mapping.MapFaceNode(f, fj);
-
-            const double mu_Nij = -face_mu_values[f] * M_surf[f](i, j);
-            Amat(i, j) += mu_Nij;
-
-            const double* psi;
-            if (is_local_face)
-              psi = fluds.UpwindPsi(spls_index, in_face_counter, fj, 0, as_ss_idx);
-            else if (not is_boundary_face)
-              psi = fluds.NLUpwindPsi(preloc_face_counter, fj, 0, as_ss_idx);
-            else
-              psi = angle_set.PsiBoundary(cell_face.neighbor_id,
-                                          direction_num,
-                                          cell_local_id,
-                                          f,
-                                          fj,
-                                          gs_gi,
-                                          gs_ss_begin,
-                                          IsSurfaceSourceActive());
+            const int j = face_nodes[fj];
 
+            const double mu_Nij = -face_mu_values[f] * matrices.FaceMassMatrix(f, fi, fj, i, j);
+            Amat[i * cell_num_nodes + j] += mu_Nij;
+
+            double* bi = &b_angle[i * num_lanes];
+
+            // Upwind psi held by the FLUDS is read in storage precision
+            if (not is_boundary_face)
+            {
+              const PsiStorage* psi =
+                is_local_face ? fluds.UpwindPsi(spls_index, in_face_counter, fj, 0, as_ss_idx)
+                              : fluds.NLUpwindPsi(ws.preloc_face_counter, fj, 0, as_ss_idx);
+              for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+                bi[gsg] += psi[gsg] * mu_Nij;
+              continue;
+            }
+
+            const double* psi = angle_set.PsiBoundary(cell_face.neighbor_id,
+                                                      direction_num,
+                                                      cell_local_id,
+                                                      f,
+                                                      fj,
+                                                      gs_gi,
+                                                      gs_ss_begin,
+                                                      IsSurfaceSourceActive());
             if (not psi)
               continue;
 
             for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-              b[gsg](i) += psi[gsg] * mu_Nij;
+              bi[gsg] += psi[gsg] * mu_Nij;
           } // for face node j
         }   // for face node i
       }     // for f
 
-      // Looping over groups, assembling mass terms
-      for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+      // Mass matrix and source
+      // Atemp = Amat + sigma_tgr * M
+      // b += M * q
+      for (int i = 0; i < cell_num_nodes; ++i)
       {
-        double sigma_tg = rho * sigma_t[gs_gi + gsg];
-
-        // Contribute source moments q = M_n^T * q_moms
-        for (int i = 0; i < cell_num_nodes; ++i)
-        {
-          double temp_src = 0.0;
-          for (int m = 0; m < num_moments_; ++m)
-          {
-            const size_t ir = cell_transport_view.MapDOF(i, m, static_cast<int>(gs_gi + gsg));
-            temp_src += m2d_op[m][direction_num] * source_moments_[ir];
-          }
-          source[i] = temp_src;
-        }
-
-        // Mass matrix and source
-        // Atemp = Amat + sigma_tgr * M
-        // b += M * q
-        for (int i = 0; i < cell_num_nodes; ++i)
+        double* bi = &b_angle[i * num_lanes];
+        for (int j = 0; j < cell_num_nodes; ++j)
         {
-          double temp = 0.0;
-          for (int j = 0; j < cell_num_nodes; ++j)
+          const double Mij = M[i * cell_num_nodes + j];
+          const double Aij = Amat[i * cell_num_nodes + j];
+          double* Atemp_ij =
+            &Atemp[(i * cell_num_nodes + j) * num_lanes + as_ss_blk * gs_ss_size];
+          const double* source_j = &source[j * num_lanes + as_ss_blk * gs_ss_size];
+          for (int gsg = 0; gsg < gs_ss_size; ++gsg)
           {
-            auto Mij = M(i, j);
-            Atemp(i, j) = Amat(i, j) + Mij * sigma_tg;
-            temp += Mij * source[j];
+            Atemp_ij[gsg] = Aij + Mij * ws.sigma_tg[gsg];
+            bi[gsg] += Mij * source_j[gsg];
           }
-          b[gsg](i) += temp;
         }
+      }
+    } // for angle in block
 
-        // Solve system
-        GaussElimination(Atemp, b[gsg], static_cast<int>(cell_num_nodes));
-      } // for gsg
+    // Solve the systems of all angles and groups in the block
+    if constexpr (NumNodes > 0)
+      BatchedGaussElimination<NumNodes>(Atemp.data(), b.data(), NumNodes, num_lanes);
+    else
+      BatchedGaussEliminationDispatch(Atemp.data(), b.data(), cell_num_nodes, num_lanes);
 
-      // Update phi
-      auto& output_phi = GetDestinationPhi();
+    // Update phi, phi += D * psi for all angles of the block
+    auto& output_phi = GetDestinationPhi();
+    for (int i = 0; i < cell_num_nodes; ++i)
       for (int m = 0; m < num_moments_; ++m)
       {
-        const double wn_d2m = d2m_op[m][direction_num];
-        for (int i = 0; i < cell_num_nodes; ++i)
+        double* phi_im = &output_phi[cell_transport_view.MapDOF(i, m, gs_gi)];
+        for (size_t as_ss_blk = 0; as_ss_blk < block_size; ++as_ss_blk)
         {
-          const size_t ir = cell_transport_view.MapDOF(i, m, gs_gi);
+          const double wn_d2m = ws.d2m_op[m][as_angle_indices[block_begin + as_ss_blk]];
+          const double* bi = &b[i * num_lanes + as_ss_blk * gs_ss_size];
           for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-            output_phi[ir + gsg] += wn_d2m * b[gsg](i);
+            phi_im[gsg] += wn_d2m * bi[gsg];
         }
       }
 
+    for (size_t as_ss_blk = 0; as_ss_blk < block_size; ++as_ss_blk)
+    {
+      const size_t as_ss_idx = block_begin + as_ss_blk;
+      auto direction_num = as_angle_indices[as_ss_idx];
+      auto omega = groupset_.quadrature->omegas[direction_num];
+      auto wt = groupset_.quadrature->weights[direction_num];
+      const double* b_angle = &b[as_ss_blk * gs_ss_size];
+
+      ws.deploc_face_counter = ni_deploc_face_counter;
+
       // Save angular flux during sweep
       if (save_angular_flux_)
       {
@@ -222,8 +579,9 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
         {
           const size_t imap =
             i * groupset_angle_group_stride_ + direction_num * groupset_group_stride_ + gs_ss_begin;
+          const double* bi = &b_angle[i * num_lanes];
           for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-            cell_psi_data[imap + gsg] = b[gsg](i);
+            cell_psi_data[imap + gsg] = bi[gsg];
         }
       }
 
@@ -240,44 +598,49 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
         const bool is_local_face = cell_transport_view.IsFaceLocal(f);
         const bool is_boundary_face = not face.has_neighbor;
         const bool is_reflecting_boundary_face =
-          (is_boundary_face and angle_set.GetBoundaries()[face.neighbor_id]->IsReflecting());
-        const auto& IntF_shapeI = unit_cell_matrices_[cell_local_id].intS_shapeI[f];
+          (is_boundary_face and angle_set.GetBoundaries().at(face.neighbor_id)->IsReflecting());
 
         if (not is_boundary_face and not is_local_face)
-          ++deploc_face_counter;
+          ++ws.deploc_face_counter;
+
+        std::unique_lock<std::mutex> outflow_lock(outflow_mutex_, std::defer_lock);
+        if (is_boundary_face)
+          outflow_lock.lock();
 
-        const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+        const double mu = matrices.FaceMu(omega, f);
+        const int* face_nodes = &info.face_nodes[info.face_node_offsets[f]];
+        const int num_face_nodes = info.face_node_offsets[f + 1] - info.face_node_offsets[f];
         for (int fi = 0; fi < num_face_nodes; ++fi)
         {
-          const int i = cell_mapping.MapFaceNode(f, fi);
+          const int i = face_nodes[fi];
+          const double* bi = &b_angle[i * num_lanes];
 
           if (is_boundary_face)
           {
             for (int gsg = 0; gsg < gs_ss_size; ++gsg)
               cell_transport_view.AddOutflow(
-                f, gs_gi + gsg, wt * face_mu_values[f] * b[gsg](i) * IntF_shapeI(i));
+                f, gs_gi + gsg, wt * mu * bi[gsg] * matrices.FaceShape(f, fi, i));
           }
 
-          double* psi = nullptr;
-          if (is_local_face)
-            psi = fluds.OutgoingPsi(spls_index, out_face_counter, fi, as_ss_idx);
-          else if (not is_boundary_face)
-            psi = fluds.NLOutgoingPsi(deploc_face_counter, fi, as_ss_idx);
+          if (not is_boundary_face)
+          {
+            PsiStorage* psi = is_local_face
+                                ? fluds.OutgoingPsi(spls_index, out_face_counter, fi, as_ss_idx)
+                                : fluds.NLOutgoingPsi(ws.deploc_face_counter, fi, as_ss_idx);
+            for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+              psi[gsg] = static_cast<PsiStorage>(bi[gsg]);
+          }
           else if (is_reflecting_boundary_face)
-            psi = angle_set.PsiReflected(
-              face.neighbor_id, direction_num, cell_local_id, f, fi, gs_ss_begin);
-          else
-            continue;
-
-          if (not is_boundary_face or is_reflecting_boundary_face)
           {
+            double* psi = angle_set.PsiReflected(
+              face.neighbor_id, direction_num, cell_local_id, f, fi, gs_ss_begin);
             for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-              psi[gsg] = b[gsg](i);
+              psi[gsg] = bi[gsg];
           }
         } // for fi
       }   // for face
-    }     // for angleset/subset
-  }       // for cell
+    }     // for angle in block
+  }       // for angle block
 }
 
 } // namespace opensn
@@ -6,6 +6,7 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/sweep_chunk.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/groupset/lbs_groupset.h"
 #include "framework/math/spatial_discretization/spatial_discretization.h"
+#include <mutex>
 
 namespace opensn
 {
@@ -15,7 +16,7 @@ class AahSweepChunk : public SweepChunk
 public:
   AahSweepChunk(const MeshContinuum& grid,
                 const SpatialDiscretization& discretization,
-                const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                const UnitCellMatricesPool& unit_cell_matrices,
                 std::vector<CellLBSView>& cell_transport_views,
                 const std::vector<double>& densities,
                 std::vector<double>& destination_phi,
@@ -24,9 +25,85 @@ public:
                 const LBSGroupset& groupset,
                 const std::map<int, std::shared_ptr<MultiGroupXS>>& xs,
                 int num_moments,
-                int max_num_cell_dofs);
+                int max_num_cell_dofs,
+                bool pack_cell_matrices = false,
+                size_t angle_block_size = 1);
 
   void Sweep(AngleSet& angle_set) override;
+
+  bool SupportsConcurrentSweeps() const override { return true; }
+
+private:
+  /// Scratch data and running face counters of a single angleset sweep.
+  struct SweepWorkspace;
+
+  /// Per-cell data precomputed to select and feed the cell kernels.
+  struct CellSweepInfo
+  {
+    /// Node count for which a specialized kernel exists, zero for the generic kernel.
+    unsigned int kernel_num_nodes = 0;
+    unsigned int num_nodes = 0;
+    /// Face-to-cell node map, face f spans [face_node_offsets[f], face_node_offsets[f + 1]).
+    std::vector<int> face_node_offsets;
+    std::vector<int> face_nodes;
+    /// Offsets of the face mass matrices within a packed cell block.
+    std::vector<int> face_matrix_offsets;
+    /// Number of doubles in the packed cell block, see PackCellMatrices.
+    size_t packed_size = 0;
+  };
+
+  /// Packed cell blocks of all local cells laid out in the sweep order of one SPDS.
+  struct CellMatrixArena
+  {
+    /// Offset of the block of each cell, indexed by position in the SPDS sweep order.
+    std::vector<size_t> offsets;
+    std::vector<double> data;
+  };
+
+  /// Cell matrix access for the cell kernels directly from UnitCellMatrices.
+  template <unsigned int NumNodes>
+  class UnitCellMatricesView;
+
+  /// Cell matrix access for the cell kernels from a packed cell block.
+  template <unsigned int NumNodes>
+  class PackedCellMatricesView;
+
+  /**
+   * Writes the matrices the sweep needs for a cell into a single contiguous block. The block
+   * holds, in order, the x, y and z components of intV_shapeI_gradshapeJ, intV_shapeI_shapeJ,
+   * the x, y and z components of the face normals, the face-node blocks of intS_shapeI_shapeJ
+   * and the face-node entries of intS_shapeI.
+   */
+  void PackCellMatrices(const Cell& cell, double* block) const;
+
+  /// Builds one packed arena for every SPDS used by the groupset's anglesets.
+  void BuildCellMatrixArenas();
+
+  /**
+   * Sweeps all angles of the angleset through a single cell. The source moments of the cell are
+   * gathered once and the angles are processed in blocks of `angle_block_size_`: the
+   * moment-to-discrete source and the discrete-to-moment update are evaluated for the whole
+   * block, and the systems of all angles and groups of a block are solved in a single batched
+   * elimination. With a nonzero `NumNodes` the node loops have compile-time trip counts.
+   * `NumNodes == 0` is the generic kernel used for polygons, polyhedra and any cell without a
+   * specialization. `MatricesView` selects whether cell matrices come from UnitCellMatrices or
+   * from a packed arena.
+   */
+  template <unsigned int NumNodes, class MatricesView>
+  void SweepCell(SweepWorkspace& ws, size_t spls_index, const double* packed_block);
+
+  /// Dispatches a cell to the kernel matching its topology.
+  template <template <unsigned int> class MatricesView>
+  void DispatchCell(SweepWorkspace& ws, size_t spls_index, const double* packed_block);
+
+  /// Number of angles whose cell systems are assembled and solved together.
+  const size_t angle_block_size_;
+  std::vector<CellSweepInfo> cell_sweep_info_;
+  size_t max_num_cell_faces_ = 0;
+  std::map<const SPDS*, CellMatrixArena> cell_matrix_arenas_;
+
+  /// Serializes boundary outflow accumulation when anglesets are swept concurrently.
+  std::mutex outflow_mutex_;
 };
 
 } // namespace opensn
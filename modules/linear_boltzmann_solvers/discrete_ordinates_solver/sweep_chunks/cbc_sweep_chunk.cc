@@ -16,7 +16,7 @@ CbcSweepChunk::CbcSweepChunk(std::vector<double>& destination_phi,
                              std::vector<double>& destination_psi,
                              const MeshContinuum& grid,
                              const SpatialDiscretization& discretization,
-                             const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                             const UnitCellMatricesPool& unit_cell_matrices,
                              std::vector<CellLBSView>& cell_transport_views,
                              const std::vector<double>& densities,
                              const std::vector<double>& source_moments,
@@ -37,6 +37,7 @@ CbcSweepChunk::CbcSweepChunk(std::vector<double>& destination_phi,
                num_moments,
                max_num_cell_dofs),
     fluds_(nullptr),
+    async_comm_(nullptr),
     gs_ss_size_(0),
     gs_ss_begin_(0),
     gs_gi_(0),
@@ -58,6 +59,7 @@ CbcSweepChunk::SetAngleSet(AngleSet& angle_set)
   CALI_CXX_MARK_SCOPE("CbcSweepChunk::SetAngleSet");
 
   fluds_ = &dynamic_cast<CBC_FLUDS&>(angle_set.GetFLUDS());
+  async_comm_ = dynamic_cast<CBC_ASynchronousCommunicator*>(angle_set.GetCommunicator());
 
   const SubSetInfo& grp_ss_info = groupset_.grp_subset_infos[angle_set.GetGroupSubset()];
 
@@ -104,6 +106,14 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
   const auto& rho = densities_[cell_local_id_];
   const auto& sigma_t = xs_.at(cell_->material_id)->SigmaTotal();
 
+  // Queue the non-local outgoing faces for sending once per cell visit. Their storage holds the
+  // psi of all angles in the set.
+  std::vector<PsiStorage*> psi_dnwnd_face_data(cell_num_faces_, nullptr);
+  for (int f = 0; f < cell_num_faces_; ++f)
+    if (face_orientations[f] == FaceOrientation::OUTGOING and cell_->faces[f].has_neighbor and
+        not cell_transport_view_->IsFaceLocal(f))
+      psi_dnwnd_face_data[f] = async_comm_->InitGetDownwindFaceData(cell_local_id_, f);
+
   // as = angle set
   // ss = subset
   const std::vector<size_t>& as_angle_indices = angle_set.GetAngleIndices();
@@ -137,17 +147,16 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
       const bool is_boundary_face = not face.has_neighbor;
       auto face_nodal_mapping = &fluds_->CommonData().GetFaceNodalMapping(cell_local_id_, f);
 
-      const std::vector<double>* psi_upwnd_data_block = nullptr;
+      const PsiStorage* psi_nonlocal_face_upwnd_data = nullptr;
       const double* psi_local_face_upwnd_data = nullptr;
       if (is_local_face)
       {
-        psi_upwnd_data_block = &fluds_->GetLocalUpwindDataBlock();
         psi_local_face_upwnd_data = fluds_->GetLocalCellUpwindPsi(
-          *psi_upwnd_data_block, *cell_transport_view_->FaceNeighbor(f));
+          fluds_->GetLocalUpwindDataBlock(), *cell_transport_view_->FaceNeighbor(f));
       }
       else if (not is_boundary_face)
       {
-        psi_upwnd_data_block = &fluds_->GetNonLocalUpwindData(cell_->global_id, f);
+        psi_nonlocal_face_upwnd_data = fluds_->GetNonLocalUpwindFaceData(cell_local_id_, f);
       }
 
       // IntSf_mu_psi_Mij_dA
@@ -163,6 +172,18 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
           const double mu_Nij = -face_mu_values[f] * M_surf_[f](i, j);
           Amat(i, j) += mu_Nij;
 
+          // Non-local upwind psi is read in storage precision
+          if (not is_local_face and not is_boundary_face)
+          {
+            assert(psi_nonlocal_face_upwnd_data);
+            const unsigned int adj_face_node = face_nodal_mapping->face_node_mapping_[fj];
+            const PsiStorage* psi =
+              fluds_->GetNonLocalUpwindPsi(psi_nonlocal_face_upwnd_data, adj_face_node, as_ss_idx);
+            for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
+              b[gsg](i) += psi[gsg] * mu_Nij;
+            continue;
+          }
+
           const double* psi = nullptr;
           if (is_local_face)
           {
@@ -171,12 +192,6 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
             psi = &psi_local_face_upwnd_data[adj_cell_node * groupset_angle_group_stride_ +
                                              direction_num * groupset_group_stride_ + gs_ss_begin_];
           }
-          else if (not is_boundary_face)
-          {
-            assert(psi_upwnd_data_block);
-            const unsigned int adj_face_node = face_nodal_mapping->face_node_mapping_[fj];
-            psi = fluds_->GetNonLocalUpwindPsi(*psi_upwnd_data_block, adj_face_node, as_ss_idx);
-          }
           else
             psi = angle_set.PsiBoundary(face.neighbor_id,
                                         direction_num,
@@ -274,20 +289,8 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
         (is_boundary_face and angle_set.GetBoundaries()[face.neighbor_id]->IsReflecting());
       const auto& IntF_shapeI = IntS_shapeI_[f];
 
-      const int locality = cell_transport_view_->FaceLocality(f);
       const size_t num_face_nodes = cell_mapping_->NumFaceNodes(f);
-      auto& face_nodal_mapping = fluds_->CommonData().GetFaceNodalMapping(cell_local_id_, f);
-      std::vector<double>* psi_dnwnd_data = nullptr;
-      if (not is_boundary_face and not is_local_face)
-      {
-        auto& async_comm = *angle_set.GetCommunicator();
-        size_t data_size = num_face_nodes * group_angle_stride_;
-        psi_dnwnd_data = &async_comm.InitGetDownwindMessageData(locality,
-                                                                face.neighbor_id,
-                                                                face_nodal_mapping.associated_face_,
-                                                                angle_set.GetID(),
-                                                                data_size);
-      }
+      PsiStorage* psi_dnwnd_data = psi_dnwnd_face_data[f];
 
       for (int fi = 0; fi < num_face_nodes; ++fi)
       {
@@ -300,25 +303,24 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
               f, gs_gi_ + gsg, wt * face_mu_values[f] * b[gsg](i) * IntF_shapeI(i));
         }
 
-        double* psi = nullptr;
         if (is_local_face)
-          psi = nullptr;
-        else if (not is_boundary_face)
+          continue;
+
+        if (not is_boundary_face)
         {
           assert(psi_dnwnd_data);
           const size_t addr_offset = fi * group_angle_stride_ + as_ss_idx * group_stride_;
-          psi = &(*psi_dnwnd_data)[addr_offset];
+          PsiStorage* psi = &psi_dnwnd_data[addr_offset];
+          for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
+            psi[gsg] = static_cast<PsiStorage>(b[gsg](i));
         }
         else if (is_reflecting_boundary_face)
-          psi = angle_set.PsiReflected(
-            face.neighbor_id, direction_num, cell_local_id_, f, fi, gs_ss_begin_);
-        if (psi)
         {
-          if (not is_boundary_face or is_reflecting_boundary_face)
-          {
+          double* psi = angle_set.PsiReflected(
+            face.neighbor_id, direction_num, cell_local_id_, f, fi, gs_ss_begin_);
+          if (psi)
             for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
               psi[gsg] = b[gsg](i);
-          }
         }
       } // for fi
     }   // for face
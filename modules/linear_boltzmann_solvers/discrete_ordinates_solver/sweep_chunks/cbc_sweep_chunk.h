@@ -4,6 +4,7 @@
 #pragma once
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/cbc_fluds.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/communicators/cbc_async_comm.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/sweep_chunk.h"
 
 namespace opensn
@@ -17,7 +18,7 @@ public:
                 std::vector<double>& destination_psi,
                 const MeshContinuum& grid,
                 const SpatialDiscretization& discretization,
-                const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                const UnitCellMatricesPool& unit_cell_matrices,
                 std::vector<CellLBSView>& cell_transport_views,
                 const std::vector<double>& densities,
                 const std::vector<double>& source_moments,
@@ -34,6 +35,7 @@ public:
 
 private:
   CBC_FLUDS* fluds_;
+  CBC_ASynchronousCommunicator* async_comm_;
   size_t gs_ss_size_;
   size_t gs_ss_begin_;
   int gs_gi_;
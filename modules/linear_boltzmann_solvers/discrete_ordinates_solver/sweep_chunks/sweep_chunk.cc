@@ -3,9 +3,13 @@
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/sweep_chunk.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "caliper/cali.h"
 
 namespace opensn
 {
+
+thread_local int SweepChunk::worker_index_ = -1;
+
 void
 SweepChunk::ZeroDestinationPhi()
 {
@@ -30,4 +34,62 @@ SweepChunk::ZeroDestinationPhi()
   }       // for cell
 }
 
+void
+SweepChunk::InitializeWorkerBuffers(int num_workers)
+{
+  const auto phi_size = destination_phi_->size();
+  if (worker_phi_.size() == static_cast<size_t>(num_workers) and
+      (worker_phi_.empty() or worker_phi_.front().size() == phi_size))
+    return;
+
+  worker_phi_.assign(num_workers, std::vector<double>(phi_size, 0.0));
+}
+
+void
+SweepChunk::WorkerSweep(AngleSet& angle_set, int worker_index)
+{
+  worker_index_ = worker_index;
+  try
+  {
+    Sweep(angle_set);
+  }
+  catch (...)
+  {
+    worker_index_ = -1;
+    throw;
+  }
+  worker_index_ = -1;
+}
+
+void
+SweepChunk::ReduceWorkerBuffers()
+{
+  CALI_CXX_MARK_SCOPE("SweepChunk::ReduceWorkerBuffers");
+
+  const auto gsi = groupset_.groups.front().id;
+  const auto gss = groupset_.groups.size();
+
+  auto& phi = *destination_phi_;
+  for (auto& worker_phi : worker_phi_)
+  {
+    for (const auto& cell : grid_.local_cells)
+    {
+      const auto& transport_view = cell_transport_views_[cell.local_id];
+
+      for (int i = 0; i < cell.vertex_ids.size(); ++i)
+      {
+        for (int m = 0; m < num_moments_; ++m)
+        {
+          const auto mapping = transport_view.MapDOF(i, m, gsi);
+          for (int g = 0; g < gss; ++g)
+          {
+            phi[mapping + g] += worker_phi[mapping + g];
+            worker_phi[mapping + g] = 0.0;
+          } // for g
+        }   // for moment
+      }     // for dof
+    }       // for cell
+  }         // for worker
+}
+
 } // namespace opensn
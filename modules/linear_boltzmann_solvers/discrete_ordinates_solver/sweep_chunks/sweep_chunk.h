@@ -30,7 +30,7 @@ public:
              std::vector<double>& destination_psi,
              const MeshContinuum& grid,
              const SpatialDiscretization& discretization,
-             const std::vector<UnitCellMatrices>& unit_cell_matrices,
+             const UnitCellMatricesPool& unit_cell_matrices,
              std::vector<CellLBSView>& cell_transport_views,
              const std::vector<double>& densities,
              const std::vector<double>& source_moments,
@@ -66,6 +66,13 @@ public:
   /// For cell-by-cell methods or computing the residual on a single cell.
   virtual void SetCell(Cell const* cell_ptr, AngleSet& angle_set) {}
 
+  /**
+   * Returns true if Sweep can be called concurrently for distinct anglesets. Sweep chunks that
+   * return true must only scatter flux moments through GetDestinationPhi and must protect any
+   * other shared state they update.
+   */
+  virtual bool SupportsConcurrentSweeps() const { return false; }
+
   virtual ~SweepChunk() = default;
 
 protected:
@@ -80,8 +87,26 @@ protected:
    */
   void ZeroDestinationPhi();
 
-  /// Returns a reference to the output flux moments vector.
-  std::vector<double>& GetDestinationPhi() { return *destination_phi_; }
+  /**
+   * Returns a reference to the output flux moments vector. On a sweep worker thread this is the
+   * accumulation buffer of that worker.
+   */
+  std::vector<double>& GetDestinationPhi()
+  {
+    return worker_index_ < 0 ? *destination_phi_ : worker_phi_[worker_index_];
+  }
+
+  /// Allocates, if needed, one zeroed flux moments accumulation buffer per sweep worker thread.
+  void InitializeWorkerBuffers(int num_workers);
+
+  /// Sweeps an angleset on a worker thread, accumulating flux moments into its worker buffer.
+  void WorkerSweep(AngleSet& angle_set, int worker_index);
+
+  /**
+   * Adds the worker buffers to the output flux moments vector in worker order and zeroes them.
+   * The fixed summation order makes the result independent of thread interleaving.
+   */
+  void ReduceWorkerBuffers();
 
   /// Sets the location where angular fluxes are to be written.
   void SetDestinationPsi(std::vector<double>& psi) { destination_psi_ = (&psi); }
@@ -100,7 +125,7 @@ protected:
 
   const MeshContinuum& grid_;
   const SpatialDiscretization& discretization_;
-  const std::vector<UnitCellMatrices>& unit_cell_matrices_;
+  const UnitCellMatricesPool& unit_cell_matrices_;
   std::vector<CellLBSView>& cell_transport_views_;
   const std::vector<double>& densities_;
   const std::vector<double>& source_moments_;
@@ -116,6 +141,10 @@ private:
   std::vector<double>* destination_phi_;
   std::vector<double>* destination_psi_;
   bool surface_source_active_ = false;
+  std::vector<std::vector<double>> worker_phi_;
+
+  /// Index of the sweep worker running on the calling thread, or -1 outside of worker sweeps.
+  static thread_local int worker_index_;
 };
 
 } // namespace opensn
@@ -13,7 +13,7 @@
 SweepChunkPWLTransientTheta::SweepChunkPWLTransientTheta(
   std::shared_ptr<MeshContinuum> grid_ptr,
   opensn::SpatialDiscretization& discretization,
-  const std::vector<UnitCellMatrices>& unit_cell_matrices,
+  const UnitCellMatricesPool& unit_cell_matrices,
   std::vector<CellLBSView>& cell_transport_views,
   std::vector<double>& destination_phi,
   std::vector<double>& destination_psi,
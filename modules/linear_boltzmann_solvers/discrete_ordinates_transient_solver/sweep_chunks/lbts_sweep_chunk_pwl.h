@@ -22,7 +22,7 @@ class SweepChunkPWLTransientTheta : public opensn::SweepChunk
 protected:
   const std::shared_ptr<MeshContinuum> grid_view_;
   opensn::SpatialDiscretization& grid_fe_view_;
-  const std::vector<UnitCellMatrices>& unit_cell_matrices_;
+  const UnitCellMatricesPool& unit_cell_matrices_;
   std::vector<CellLBSView>& grid_transport_view_;
   const std::vector<double>& q_moments_;
   LBSGroupset& groupset_;
@@ -47,7 +47,7 @@ public:
 
   SweepChunkPWLTransientTheta(std::shared_ptr<MeshContinuum> grid_ptr,
                               opensn::SpatialDiscretization& discretization,
-                              const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                              const UnitCellMatricesPool& unit_cell_matrices,
                               std::vector<CellLBSView>& cell_transport_views,
                               std::vector<double>& destination_phi,
                               std::vector<double>& destination_psi,
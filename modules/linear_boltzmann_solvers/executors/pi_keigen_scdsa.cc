@@ -447,8 +447,9 @@ PowerIterationKEigenSCDSA::NodallyAveragedPWLDVector(
   const auto& vgc = ghost_info.vector_ghost_communicator;
   const auto& dfem_dof_global2local_map = ghost_info.ghost_global_id_2_local_map;
 
+  // The ghost update overlaps with the local cell contributions, which only need owned entries
   auto input_with_ghosts = vgc->MakeGhostedVector(input);
-  vgc->CommunicateGhostEntries(input_with_ghosts);
+  vgc->BeginGhostCommunication(input_with_ghosts);
 
   const auto& grid = pwld_sdm.Grid();
 
@@ -496,6 +497,8 @@ PowerIterationKEigenSCDSA::NodallyAveragedPWLDVector(
             partition_bndry_vertex_id_set.insert(vid);
   } // for local cell
 
+  vgc->EndGhostCommunication(input_with_ghosts);
+
   // Ghost cells
   const auto ghost_cell_ids = grid.cells.GetGhostGlobalIDs();
   const auto& vid_set = partition_bndry_vertex_id_set;
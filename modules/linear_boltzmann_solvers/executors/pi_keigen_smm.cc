@@ -1060,8 +1060,9 @@ PowerIterationKEigenSMM::ComputeNodallyAveragedPWLDVector(const std::vector<doub
   const auto& ghost_comm = ghost_info.vector_ghost_communicator;
   const auto& pwld_global_to_local_map = ghost_info.ghost_global_to_local_map;
 
+  // The ghost update overlaps with the local cell contributions, which only need owned entries
   auto ghosted_pwld_vector = ghost_comm->MakeGhostedVector(pwld_vector);
-  ghost_comm->CommunicateGhostEntries(ghosted_pwld_vector);
+  ghost_comm->BeginGhostCommunication(ghosted_pwld_vector);
 
   const auto& grid = pwld.Grid();
   const auto num_local_pwlc_dofs = pwlc.GetNumLocalAndGhostDOFs(uk_man);
@@ -1105,6 +1106,8 @@ PowerIterationKEigenSMM::ComputeNodallyAveragedPWLDVector(const std::vector<doub
             partition_vertex_ids.insert(vertex_id);
   } // for local cell
 
+  ghost_comm->EndGhostCommunication(ghosted_pwld_vector);
+
   // Add ghost cell data
   const auto ghost_cell_ids = grid.cells.GetGhostGlobalIDs();
   const auto& pvids = partition_vertex_ids;
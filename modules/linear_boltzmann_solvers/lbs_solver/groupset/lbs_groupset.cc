@@ -53,6 +53,11 @@ LBSGroupset::GetInputParameters()
                               30,
                               "If this inner linear solver is gmres, sets the number of "
                               "iterations before a restart occurs.");
+  params.AddOptionalParameter("anderson_depth",
+                              0,
+                              "If this inner linear solver is classic_richardson and this is "
+                              "positive, accelerates the iterations with Anderson mixing over "
+                              "this many previous iterates. The history is restarted once full.");
   params.AddOptionalParameter(
     "allow_cycles", true, "Flag indicating whether cycles are to be allowed or not");
 
@@ -89,6 +94,7 @@ LBSGroupset::GetInputParameters()
   params.ConstrainParameterRange("l_abs_tol", AllowableRangeLowLimit::New(1.0e-18));
   params.ConstrainParameterRange("l_max_its", AllowableRangeLowLimit::New(0));
   params.ConstrainParameterRange("gmres_restart_interval", AllowableRangeLowLimit::New(1));
+  params.ConstrainParameterRange("anderson_depth", AllowableRangeLowLimit::New(0));
 
   return params;
 }
@@ -109,6 +115,7 @@ LBSGroupset::Init(int aid)
   residual_tolerance = 1.0e-6;
   max_iterations = 200;
   gmres_restart_intvl = 30;
+  anderson_depth = 0;
   allow_cycles = false;
   apply_wgdsa = false;
   apply_tgdsa = false;
@@ -193,6 +200,7 @@ LBSGroupset::LBSGroupset(const InputParameters& params, const int id, const LBSS
     iterative_method = LinearSolver::IterativeMethod::PETSC_BICGSTAB;
 
   gmres_restart_intvl = params.GetParamValue<int>("gmres_restart_interval");
+  anderson_depth = params.GetParamValue<int>("anderson_depth");
   allow_cycles = params.GetParamValue<bool>("allow_cycles");
   residual_tolerance = params.GetParamValue<double>("l_abs_tol");
   max_iterations = params.GetParamValue<int>("l_max_its");
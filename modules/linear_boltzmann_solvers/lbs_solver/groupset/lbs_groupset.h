@@ -41,6 +41,7 @@ public:
   double residual_tolerance;
   int max_iterations;
   int gmres_restart_intvl;
+  int anderson_depth;
 
   bool allow_cycles;
 
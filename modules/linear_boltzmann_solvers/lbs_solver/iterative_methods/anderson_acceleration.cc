@@ -0,0 +1,160 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/anderson_acceleration.h"
+#include "framework/logging/log.h"
+#include "framework/runtime.h"
+#include <algorithm>
+#include <cmath>
+
+namespace opensn
+{
+
+AndersonAcceleration::AndersonAcceleration(size_t depth,
+                                           size_t block_offset,
+                                           size_t block_size,
+                                           size_t block_stride)
+  : depth_(depth),
+    block_offset_(block_offset),
+    block_size_(block_size),
+    block_stride_(block_stride),
+    delta_f_(depth),
+    delta_g_(depth),
+    gram_(depth, depth),
+    gamma_(depth)
+{
+  OpenSnInvalidArgumentIf(depth == 0, "The Anderson acceleration depth must be positive.");
+  OpenSnInvalidArgumentIf(block_offset + block_size > block_stride,
+                          "The mixed entries must lie within a block.");
+}
+
+void
+AndersonAcceleration::Reset()
+{
+  num_differences_ = 0;
+  has_previous_ = false;
+}
+
+void
+AndersonAcceleration::Mix(const std::vector<double>& g, std::vector<double>& x)
+{
+  const size_t history_size = x.size() / block_stride_ * block_size_;
+  f_prev_.resize(history_size);
+  g_prev_.resize(history_size);
+
+  if (has_previous_)
+  {
+    // Restart once the history is full
+    if (num_differences_ == depth_)
+      num_differences_ = 0;
+
+    auto& delta_f = delta_f_[num_differences_];
+    auto& delta_g = delta_g_[num_differences_];
+    delta_f.resize(history_size);
+    delta_g.resize(history_size);
+    ForEachMixedEntry(x.size(),
+                      [&](size_t i, size_t k)
+                      {
+                        const double f = g[i] - x[i];
+                        delta_f[k] = f - f_prev_[k];
+                        delta_g[k] = g[i] - g_prev_[k];
+                        f_prev_[k] = f;
+                        g_prev_[k] = g[i];
+                      });
+    ++num_differences_;
+  }
+  else
+  {
+    ForEachMixedEntry(x.size(),
+                      [&](size_t i, size_t k)
+                      {
+                        f_prev_[k] = g[i] - x[i];
+                        g_prev_[k] = g[i];
+                      });
+    has_previous_ = true;
+  }
+
+  // Fall back to a fixed-point update without a usable history
+  if (num_differences_ == 0 or not ComputeCoefficients())
+  {
+    num_differences_ = 0;
+    ForEachMixedEntry(x.size(), [&](size_t i, size_t) { x[i] = g[i]; });
+    return;
+  }
+
+  ForEachMixedEntry(x.size(),
+                    [&](size_t i, size_t k)
+                    {
+                      double value = g[i];
+                      for (size_t j = 0; j < num_differences_; ++j)
+                        value -= gamma_(j) * delta_g_[j][k];
+                      x[i] = value;
+                    });
+}
+
+bool
+AndersonAcceleration::ComputeCoefficients()
+{
+  // The current residual is the last one stored
+  const size_t n = num_differences_;
+  const size_t num_products = n * (n + 1) / 2 + n;
+  local_products_.assign(num_products, 0.0);
+  products_.assign(num_products, 0.0);
+
+  size_t p = 0;
+  for (size_t i = 0; i < n; ++i)
+  {
+    const auto& delta_f_i = delta_f_[i];
+    for (size_t j = i; j < n; ++j, ++p)
+    {
+      const auto& delta_f_j = delta_f_[j];
+      double product = 0.0;
+      for (size_t k = 0; k < delta_f_i.size(); ++k)
+        product += delta_f_i[k] * delta_f_j[k];
+      local_products_[p] = product;
+    }
+  }
+  for (size_t i = 0; i < n; ++i, ++p)
+  {
+    const auto& delta_f_i = delta_f_[i];
+    double product = 0.0;
+    for (size_t k = 0; k < delta_f_i.size(); ++k)
+      product += delta_f_i[k] * f_prev_[k];
+    local_products_[p] = product;
+  }
+
+  mpi_comm.all_reduce(local_products_.data(),
+                      static_cast<int>(num_products),
+                      products_.data(),
+                      mpi::op::sum<double>());
+
+  // Unpack the normal equations and regularize them relative to their largest diagonal
+  p = 0;
+  double max_diagonal = 0.0;
+  for (size_t i = 0; i < n; ++i)
+    for (size_t j = i; j < n; ++j, ++p)
+    {
+      gram_(i, j) = products_[p];
+      gram_(j, i) = products_[p];
+      if (i == j)
+        max_diagonal = std::max(max_diagonal, products_[p]);
+    }
+  for (size_t i = 0; i < n; ++i, ++p)
+    gamma_(i) = products_[p];
+
+  if (not(max_diagonal > 0.0))
+    return false;
+
+  for (size_t i = 0; i < n; ++i)
+    gram_(i, i) += 1.0e-12 * max_diagonal;
+
+  GaussElimination(gram_, gamma_, static_cast<unsigned int>(n));
+
+  for (size_t i = 0; i < n; ++i)
+    if (not std::isfinite(gamma_(i)))
+      return false;
+
+  return true;
+}
+
+} // namespace opensn
@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "framework/math/dense_matrix.h"
+#include "framework/math/vector.h"
+#include <cstddef>
+#include <vector>
+
+namespace opensn
+{
+
+/**
+ * Restarted Anderson mixing for a fixed-point iteration x = G(x) distributed over all locations.
+ *
+ * Only part of the iterate takes part in the mixing: the iterate is a sequence of blocks of
+ * `block_stride` entries, of which the `block_size` entries starting at `block_offset` are mixed.
+ * For flux moments this selects the groups of a groupset. The residual and image differences of
+ * the last `depth` iterates are stored for the mixed entries only, and the history is discarded
+ * once it holds `depth` differences.
+ */
+class AndersonAcceleration
+{
+public:
+  AndersonAcceleration(size_t depth, size_t block_offset, size_t block_size, size_t block_stride);
+
+  /// Discards the stored history. The next mix is a plain fixed-point update.
+  void Reset();
+
+  /**
+   * Given the current iterate `x` and its image `g` = G(`x`), overwrites the mixed entries of `x`
+   * with the next iterate. Collective.
+   */
+  void Mix(const std::vector<double>& g, std::vector<double>& x);
+
+  /// Returns the number of differences the last mix was computed with.
+  size_t NumDifferences() const { return num_differences_; }
+
+private:
+  /**
+   * Calls `function(i, k)` for every mixed entry, where `i` is the index in a full vector of size
+   * `vector_size` and `k` the index in the history.
+   */
+  template <typename Function>
+  void ForEachMixedEntry(size_t vector_size, Function function) const
+  {
+    const size_t num_blocks = vector_size / block_stride_;
+    size_t k = 0;
+    for (size_t b = 0; b < num_blocks; ++b)
+    {
+      const size_t offset = b * block_stride_ + block_offset_;
+      for (size_t i = offset; i < offset + block_size_; ++i)
+        function(i, k++);
+    }
+  }
+
+  /**
+   * Solves the least-squares problem for the mixing coefficients of the current residual. Returns
+   * false when the normal equations are singular. Collective.
+   */
+  bool ComputeCoefficients();
+
+  const size_t depth_;
+  const size_t block_offset_;
+  const size_t block_size_;
+  const size_t block_stride_;
+
+  size_t num_differences_ = 0;
+  bool has_previous_ = false;
+
+  /// Residual and image of the previous iterate.
+  std::vector<double> f_prev_, g_prev_;
+  /// Residual and image differences of consecutive iterates.
+  std::vector<std::vector<double>> delta_f_, delta_g_;
+  /// Upper triangle of the normal equations followed by their right-hand side, per location.
+  std::vector<double> local_products_, products_;
+  DenseMatrix<double> gram_;
+  Vector<double> gamma_;
+};
+
+} // namespace opensn
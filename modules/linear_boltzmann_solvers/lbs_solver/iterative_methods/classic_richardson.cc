@@ -12,6 +12,7 @@
 #include "framework/runtime.h"
 #include <memory>
 #include <iomanip>
+#include <cmath>
 
 namespace opensn
 {
@@ -19,6 +20,12 @@ namespace opensn
 ClassicRichardson::ClassicRichardson(const std::shared_ptr<WGSContext>& gs_context_ptr)
   : LinearSolver(LinearSolver::IterativeMethod::CLASSIC_RICHARDSON, gs_context_ptr)
 {
+  const auto& groupset = gs_context_ptr->groupset;
+  if (groupset.anderson_depth > 0)
+    anderson_ = std::make_unique<AndersonAcceleration>(groupset.anderson_depth,
+                                                       groupset.groups.front().id,
+                                                       groupset.groups.size(),
+                                                       gs_context_ptr->lbs_solver.NumGroups());
 }
 
 ClassicRichardson::~ClassicRichardson()
@@ -33,25 +40,38 @@ ClassicRichardson::Solve()
 
   auto& groupset = gs_context_ptr->groupset;
   auto& lbs_solver = gs_context_ptr->lbs_solver;
+  auto& workspace = gs_context_ptr->workspace;
   auto& phi_old = lbs_solver.PhiOldLocal();
   auto& phi_new = lbs_solver.PhiNewLocal();
+  auto& q_moments_local = lbs_solver.QMomentsLocal();
   const auto scope = gs_context_ptr->lhs_src_scope | gs_context_ptr->rhs_src_scope;
-  saved_q_moments_local_ = lbs_solver.QMomentsLocal();
-  psi_old_.resize(groupset.angle_agg->GetNumDelayedAngularDOFs().first, 0.0);
+
+  // The source function only adds to the moments of the groupset, so only those are restored
+  auto& saved_q_moments_local = workspace.saved_q_moments_local;
+  saved_q_moments_local.resize(q_moments_local.size());
+  lbs_solver.GSScopedCopyPrimarySTLvectors(groupset, q_moments_local, saved_q_moments_local);
+
+  if (anderson_)
+    anderson_->Reset();
 
   double pw_phi_change_prev = 1.0;
+  double pw_phi_change_first = 0.0;
+  double pw_si_ratio = 0.0;
+  int num_sweeps = 0;
   bool converged = false;
   for (int k = 0; k < groupset.max_iterations; ++k)
   {
-    lbs_solver.QMomentsLocal() = saved_q_moments_local_;
-    gs_context_ptr->set_source_function(groupset, lbs_solver.QMomentsLocal(), phi_old, scope);
+    ++num_sweeps;
+    if (k > 0)
+      lbs_solver.GSScopedCopyPrimarySTLvectors(groupset, saved_q_moments_local, q_moments_local);
+    gs_context_ptr->set_source_function(groupset, q_moments_local, phi_old, scope);
     gs_context_ptr->ApplyInverseTransportOperator(scope);
 
     // Apply WGDSA
     if (groupset.apply_wgdsa)
     {
-      std::vector<double> delta_phi;
-      lbs_solver.AssembleWGDSADeltaPhiVector(groupset, phi_new - phi_old, delta_phi);
+      auto& delta_phi = workspace.wgdsa_delta_phi;
+      lbs_solver.AssembleWGDSADeltaPhiVector(groupset, phi_new, phi_old, delta_phi);
       groupset.wgdsa_solver->Assemble_b(delta_phi);
       groupset.wgdsa_solver->Solve(delta_phi);
       lbs_solver.DisAssembleWGDSADeltaPhiVector(groupset, delta_phi, phi_new);
@@ -60,8 +80,8 @@ ClassicRichardson::Solve()
     // Apply TGDSA
     if (groupset.apply_tgdsa)
     {
-      std::vector<double> delta_phi;
-      lbs_solver.AssembleTGDSADeltaPhiVector(groupset, phi_new - phi_old, delta_phi);
+      auto& delta_phi = workspace.tgdsa_delta_phi;
+      lbs_solver.AssembleTGDSADeltaPhiVector(groupset, phi_new, phi_old, delta_phi);
       groupset.tgdsa_solver->Assemble_b(delta_phi);
       groupset.tgdsa_solver->Solve(delta_phi);
       lbs_solver.DisAssembleTGDSADeltaPhiVector(groupset, delta_phi, phi_new);
@@ -71,8 +91,13 @@ ClassicRichardson::Solve()
     double rho = (k == 0) ? 0.0 : sqrt(pw_phi_change / pw_phi_change_prev);
     pw_phi_change_prev = pw_phi_change;
 
-    psi_new_ = groupset.angle_agg->GetNewDelayedAngularDOFsAsSTLVector();
-    double pw_psi_change = ComputePointwiseChange(psi_new_, psi_old_);
+    // The first update is never mixed, so the first two changes give the source iteration rate
+    if (k == 0)
+      pw_phi_change_first = pw_phi_change;
+    else if (k == 1 and pw_phi_change_first > 0.0)
+      pw_si_ratio = pw_phi_change / pw_phi_change_first;
+
+    double pw_psi_change = groupset.angle_agg->ComputePointwiseDelayedPsiChange();
 
     if ((pw_phi_change < std::max(groupset.residual_tolerance * (1.0 - rho), 1.0e-10)) &&
         (pw_psi_change < std::max(groupset.residual_tolerance, 1.0e-10)))
@@ -81,10 +106,12 @@ ClassicRichardson::Solve()
     }
     else
     {
-      lbs_solver.GSScopedCopyPrimarySTLvectors(
-        groupset, PhiSTLOption::PHI_NEW, PhiSTLOption::PHI_OLD);
-      groupset.angle_agg->SetOldDelayedAngularDOFsFromSTLVector(psi_new_);
-      psi_old_ = psi_new_;
+      // The sweep overwrites all new delayed angular fluxes, so only the old ones are updated
+      if (anderson_)
+        anderson_->Mix(phi_new, phi_old);
+      else
+        lbs_solver.GSScopedCopyPrimarySTLvectors(groupset, phi_new, phi_old);
+      groupset.angle_agg->SetDelayedPsiNew2Old();
     }
 
     std::stringstream iter_stats;
@@ -104,7 +131,19 @@ ClassicRichardson::Solve()
       log.Log() << iter_stats.str();
   }
 
-  lbs_solver.QMomentsLocal() = saved_q_moments_local_;
+  // Estimate the number of sweeps source iteration needs for the same reduction of the change
+  if (anderson_ and pw_si_ratio > 0.0 and pw_si_ratio < 1.0 and pw_phi_change_prev > 0.0)
+  {
+    const double num_si_sweeps =
+      1.0 + std::log(pw_phi_change_prev / pw_phi_change_first) / std::log(pw_si_ratio);
+    const int num_sweeps_saved = static_cast<int>(std::ceil(num_si_sweeps)) - num_sweeps;
+    log.Log() << program_timer.GetTimeString() << " WGS groups [" << groupset.groups.front().id
+              << "-" << groupset.groups.back().id << "]:"
+              << " Anderson acceleration sweeps = " << num_sweeps
+              << " Estimated sweeps saved = " << std::max(num_sweeps_saved, 0);
+  }
+
+  lbs_solver.GSScopedCopyPrimarySTLvectors(groupset, saved_q_moments_local, q_moments_local);
 
   gs_context_ptr->PostSolveCallback();
 }
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/wgs_context.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/anderson_acceleration.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/groupset/lbs_groupset.h"
 #include "framework/math/linear_solver/linear_solver.h"
 #include <memory>
@@ -15,7 +16,8 @@ namespace opensn
 
 /**
  * Linear Solver specialization for Within GroupSet (WGS) solves with classic
- * Richardson.
+ * Richardson. When the groupset sets an Anderson depth, the flux moments of the
+ * groupset are updated with Anderson mixing instead of plain source iteration.
  */
 class ClassicRichardson : public LinearSolver
 {
@@ -28,11 +30,15 @@ public:
 
   ~ClassicRichardson() override;
 
+  /**
+   * Performs source iterations. The buffers of an iteration live in the workspace of the context,
+   * so that an iteration only performs the sweep and a fixed number of passes over the flux
+   * moments and delayed angular fluxes of the groupset.
+   */
   void Solve() override;
 
 private:
-  std::vector<double> saved_q_moments_local_;
-  std::vector<double> psi_new_, psi_old_;
+  std::unique_ptr<AndersonAcceleration> anderson_;
 };
 
 } // namespace opensn
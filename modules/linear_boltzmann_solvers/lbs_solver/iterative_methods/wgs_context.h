@@ -16,6 +16,20 @@ namespace opensn
 class LBSGroupset;
 class LBSSolver;
 
+/**
+ * Buffers reused by every iteration of a within-groupset solve. They are sized on first use and
+ * keep their storage between iterations and solves.
+ */
+struct WGSWorkspace
+{
+  /// Source moments at the start of the solve, restored before every source evaluation.
+  std::vector<double> saved_q_moments_local;
+  /// Right-hand side and solution of the within-group DSA solve.
+  std::vector<double> wgdsa_delta_phi;
+  /// Right-hand side and solution of the two-grid DSA solve.
+  std::vector<double> tgdsa_delta_phi;
+};
+
 struct WGSContext : public LinearSolverContext
 {
   LBSSolver& lbs_solver;
@@ -25,6 +39,7 @@ struct WGSContext : public LinearSolverContext
   SourceFlags rhs_src_scope;
   bool log_info = true;
   size_t counter_applications_of_inv_op = 0;
+  WGSWorkspace workspace;
 
   WGSContext(LBSSolver& lbs_solver,
              LBSGroupset& groupset,
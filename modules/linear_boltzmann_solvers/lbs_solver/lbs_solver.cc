@@ -22,6 +22,7 @@
 #include "framework/runtime.h"
 #include "caliper/cali.h"
 #include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <fstream>
 #include <cstring>
@@ -227,7 +228,7 @@ LBSSolver::SpatialDiscretization() const
   return *discretization_;
 }
 
-const std::vector<UnitCellMatrices>&
+const UnitCellMatricesPool&
 LBSSolver::GetUnitCellMatrices() const
 {
   return unit_cell_matrices_;
@@ -1162,11 +1163,54 @@ LBSSolver::ComputeUnitIntegrals()
                             IntS_shapeI};
   };
 
+  // Returns a key identifying the geometry of a cell up to a translation. Vertex positions are
+  // taken relative to the first vertex and rounded to a small fraction of the cell size.
+  const auto& grid = *grid_ptr_;
+  auto CellGeometryKey = [&grid](const Cell& cell)
+  {
+    const auto& v0 = grid.vertices[cell.vertex_ids.front()];
+    double cell_size = 0.0;
+    for (const auto vid : cell.vertex_ids)
+      cell_size = std::max(cell_size, (grid.vertices[vid] - v0).Norm());
+    const double resolution = cell_size > 0.0 ? 1.0e-10 * cell_size : 1.0;
+
+    UnitCellMatricesPool::GeometryKey key = {static_cast<int64_t>(cell.Type()),
+                                             static_cast<int64_t>(cell.SubType()),
+                                             static_cast<int64_t>(cell.vertex_ids.size())};
+    for (const auto vid : cell.vertex_ids)
+    {
+      const auto dx = grid.vertices[vid] - v0;
+      for (int d = 0; d < 3; ++d)
+        key.push_back(std::llround(dx[d] / resolution));
+    }
+    for (const auto& face : cell.faces)
+    {
+      key.push_back(static_cast<int64_t>(face.vertex_ids.size()));
+      for (const auto vid : face.vertex_ids)
+        key.push_back(std::find(cell.vertex_ids.begin(), cell.vertex_ids.end(), vid) -
+                      cell.vertex_ids.begin());
+    }
+    return key;
+  };
+
+  // Position-weighted and curvilinear integrals differ between translated cells
+  const bool share_matrices = sdm.GetCoordinateSystemType() == CoordinateSystemType::CARTESIAN and
+                              options_.geometry_type != GeometryType::ONED_SPHERICAL and
+                              options_.geometry_type != GeometryType::TWOD_CYLINDRICAL;
+
   const size_t num_local_cells = grid_ptr_->local_cells.size();
-  unit_cell_matrices_.resize(num_local_cells);
+  unit_cell_matrices_.Reset(num_local_cells);
 
   for (const auto& cell : grid_ptr_->local_cells)
-    unit_cell_matrices_[cell.local_id] = ComputeCellUnitIntegrals(cell, *swf_ptr);
+  {
+    if (share_matrices)
+    {
+      auto ComputeMatrices = [&]() { return ComputeCellUnitIntegrals(cell, *swf_ptr); };
+      unit_cell_matrices_.SetCellMatrices(cell.local_id, CellGeometryKey(cell), ComputeMatrices);
+    }
+    else
+      unit_cell_matrices_.SetCellMatrices(cell.local_id, ComputeCellUnitIntegrals(cell, *swf_ptr));
+  }
 
   const auto ghost_ids = grid_ptr_->cells.GetGhostGlobalIDs();
   for (uint64_t ghost_id : ghost_ids)
@@ -1174,15 +1218,18 @@ LBSSolver::ComputeUnitIntegrals()
       ComputeCellUnitIntegrals(grid_ptr_->cells[ghost_id], *swf_ptr);
 
   // Assessing global unit cell matrix storage
-  std::array<size_t, 2> num_local_ucms = {unit_cell_matrices_.size(),
-                                          unit_ghost_cell_matrices_.size()};
-  std::array<size_t, 2> num_globl_ucms = {0, 0};
+  std::array<size_t, 3> num_local_ucms = {unit_cell_matrices_.size(),
+                                          unit_ghost_cell_matrices_.size(),
+                                          unit_cell_matrices_.NumUniqueMatrices()};
+  std::array<size_t, 3> num_globl_ucms = {0, 0, 0};
 
-  mpi_comm.all_reduce(num_local_ucms.data(), 2, num_globl_ucms.data(), mpi::op::sum<size_t>());
+  mpi_comm.all_reduce(num_local_ucms.data(), 3, num_globl_ucms.data(), mpi::op::sum<size_t>());
 
   opensn::mpi_comm.barrier();
   log.Log() << "Ghost cell unit cell-matrix ratio: "
             << (double)num_globl_ucms[1] * 100 / (double)num_globl_ucms[0] << "%";
+  log.Log() << "Distinct unit cell-matrix ratio: "
+            << (double)num_globl_ucms[2] * 100 / (double)num_globl_ucms[0] << "%";
   log.Log() << "Cell matrices computed.";
 }
 
@@ -1736,13 +1783,12 @@ LBSSolver::GSProjectBackPhi0(const LBSGroupset& groupset,
   }   // for cell
 }
 
+template <typename PhiFunction>
 void
-LBSSolver::AssembleWGDSADeltaPhiVector(const LBSGroupset& groupset,
-                                       const std::vector<double>& phi_in,
-                                       std::vector<double>& delta_phi_local)
+LBSSolver::AssembleWGDSADeltaPhi(const LBSGroupset& groupset,
+                                 PhiFunction phi,
+                                 std::vector<double>& delta_phi_local)
 {
-  CALI_CXX_MARK_SCOPE("LBSSolver::AssembleWGDSADeltaPhiVector");
-
   const auto& sdm = *discretization_;
   const auto& dphi_uk_man = groupset.wgdsa_solver->UnknownStructure();
   const auto& phi_uk_man = flux_moments_uk_man_;
@@ -1750,8 +1796,8 @@ LBSSolver::AssembleWGDSADeltaPhiVector(const LBSGroupset& groupset,
   const int gsi = groupset.groups.front().id;
   const size_t gss = groupset.groups.size();
 
-  delta_phi_local.clear();
-  delta_phi_local.assign(sdm.GetNumLocalDOFs(dphi_uk_man), 0.0);
+  // Every entry is overwritten below
+  delta_phi_local.resize(sdm.GetNumLocalDOFs(dphi_uk_man));
 
   for (const auto& cell : grid_ptr_->local_cells)
   {
@@ -1765,14 +1811,33 @@ LBSSolver::AssembleWGDSADeltaPhiVector(const LBSGroupset& groupset,
       const int64_t phi_map = sdm.MapDOFLocal(cell, i, phi_uk_man, 0, gsi);
 
       double* delta_phi_mapped = &delta_phi_local[dphi_map];
-      const double* phi_in_mapped = &phi_in[phi_map];
-
       for (size_t g = 0; g < gss; ++g)
-      {
-        delta_phi_mapped[g] = sigma_s[gsi + g] * phi_in_mapped[g];
-      } // for g
-    }   // for node
-  }     // for cell
+        delta_phi_mapped[g] = sigma_s[gsi + g] * phi(phi_map + g);
+    } // for node
+  }   // for cell
+}
+
+void
+LBSSolver::AssembleWGDSADeltaPhiVector(const LBSGroupset& groupset,
+                                       const std::vector<double>& phi_in,
+                                       std::vector<double>& delta_phi_local)
+{
+  CALI_CXX_MARK_SCOPE("LBSSolver::AssembleWGDSADeltaPhiVector");
+
+  AssembleWGDSADeltaPhi(
+    groupset, [&phi_in](size_t k) { return phi_in[k]; }, delta_phi_local);
+}
+
+void
+LBSSolver::AssembleWGDSADeltaPhiVector(const LBSGroupset& groupset,
+                                       const std::vector<double>& phi_new,
+                                       const std::vector<double>& phi_old,
+                                       std::vector<double>& delta_phi_local)
+{
+  CALI_CXX_MARK_SCOPE("LBSSolver::AssembleWGDSADeltaPhiVector");
+
+  AssembleWGDSADeltaPhi(
+    groupset, [&](size_t k) { return phi_new[k] - phi_old[k]; }, delta_phi_local);
 }
 
 void
@@ -1881,20 +1946,18 @@ LBSSolver::CleanUpTGDSA(LBSGroupset& groupset)
     groupset.tgdsa_solver = nullptr;
 }
 
+template <typename PhiFunction>
 void
-LBSSolver::AssembleTGDSADeltaPhiVector(const LBSGroupset& groupset,
-                                       const std::vector<double>& phi_in,
-                                       std::vector<double>& delta_phi_local)
+LBSSolver::AssembleTGDSADeltaPhi(const LBSGroupset& groupset,
+                                 PhiFunction phi,
+                                 std::vector<double>& delta_phi_local)
 {
-  CALI_CXX_MARK_SCOPE("LBSSolver::AssembleTGDSADeltaPhiVector");
-
   const auto& sdm = *discretization_;
   const auto& phi_uk_man = flux_moments_uk_man_;
 
   const int gsi = groupset.groups.front().id;
   const size_t gss = groupset.groups.size();
 
-  delta_phi_local.clear();
   delta_phi_local.assign(local_node_count_, 0.0);
 
   for (const auto& cell : grid_ptr_->local_cells)
@@ -1909,14 +1972,13 @@ LBSSolver::AssembleTGDSADeltaPhiVector(const LBSGroupset& groupset,
       const int64_t phi_map = sdm.MapDOFLocal(cell, i, phi_uk_man, 0, 0);
 
       double& delta_phi_mapped = delta_phi_local[dphi_map];
-      const double* phi_in_mapped = &phi_in[phi_map];
 
       for (size_t g = 0; g < gss; ++g)
       {
         double R_g = 0.0;
         for (const auto& [row_g, gprime, sigma_sm] : S.Row(gsi + g))
           if (gprime >= gsi and gprime != (gsi + g))
-            R_g += sigma_sm * phi_in_mapped[gprime];
+            R_g += sigma_sm * phi(phi_map + gprime);
 
         delta_phi_mapped += R_g;
       } // for g
@@ -1924,6 +1986,29 @@ LBSSolver::AssembleTGDSADeltaPhiVector(const LBSGroupset& groupset,
   }     // for cell
 }
 
+void
+LBSSolver::AssembleTGDSADeltaPhiVector(const LBSGroupset& groupset,
+                                       const std::vector<double>& phi_in,
+                                       std::vector<double>& delta_phi_local)
+{
+  CALI_CXX_MARK_SCOPE("LBSSolver::AssembleTGDSADeltaPhiVector");
+
+  AssembleTGDSADeltaPhi(
+    groupset, [&phi_in](size_t k) { return phi_in[k]; }, delta_phi_local);
+}
+
+void
+LBSSolver::AssembleTGDSADeltaPhiVector(const LBSGroupset& groupset,
+                                       const std::vector<double>& phi_new,
+                                       const std::vector<double>& phi_old,
+                                       std::vector<double>& delta_phi_local)
+{
+  CALI_CXX_MARK_SCOPE("LBSSolver::AssembleTGDSADeltaPhiVector");
+
+  AssembleTGDSADeltaPhi(
+    groupset, [&](size_t k) { return phi_new[k] - phi_old[k]; }, delta_phi_local);
+}
+
 void
 LBSSolver::DisAssembleTGDSADeltaPhiVector(const LBSGroupset& groupset,
                                           const std::vector<double>& delta_phi_local,
@@ -123,7 +123,7 @@ public:
   const class SpatialDiscretization& SpatialDiscretization() const;
 
   /// Returns read-only access to the unit cell matrices.
-  const std::vector<UnitCellMatrices>& GetUnitCellMatrices() const;
+  const UnitCellMatricesPool& GetUnitCellMatrices() const;
 
   /// Returns read-only access to the unit ghost cell matrices.
   const std::map<uint64_t, UnitCellMatrices>& GetUnitGhostCellMatrices() const;
@@ -233,6 +233,15 @@ public:
                                    const std::vector<double>& phi_in,
                                    std::vector<double>& delta_phi_local);
 
+  /**
+   * Assembles a delta-phi vector on the first moment from the difference of two flux moment
+   * vectors, without forming the difference. `delta_phi_local` is reused when already sized.
+   */
+  void AssembleWGDSADeltaPhiVector(const LBSGroupset& groupset,
+                                   const std::vector<double>& phi_new,
+                                   const std::vector<double>& phi_old,
+                                   std::vector<double>& delta_phi_local);
+
   /// DAssembles a delta-phi vector on the first moment.
   void DisAssembleWGDSADeltaPhiVector(const LBSGroupset& groupset,
                                       const std::vector<double>& delta_phi_local,
@@ -243,6 +252,15 @@ public:
                                    const std::vector<double>& phi_in,
                                    std::vector<double>& delta_phi_local);
 
+  /**
+   * Assembles a delta-phi vector on the first moment from the difference of two flux moment
+   * vectors, without forming the difference. `delta_phi_local` is reused when already sized.
+   */
+  void AssembleTGDSADeltaPhiVector(const LBSGroupset& groupset,
+                                   const std::vector<double>& phi_new,
+                                   const std::vector<double>& phi_old,
+                                   std::vector<double>& delta_phi_local);
+
   /// DAssembles a delta-phi vector on the first moment.
   void DisAssembleTGDSADeltaPhiVector(const LBSGroupset& groupset,
                                       const std::vector<double>& delta_phi_local,
@@ -394,7 +412,7 @@ protected:
   std::shared_ptr<MPICommunicatorSet> grid_local_comm_set_ = nullptr;
   std::shared_ptr<GridFaceHistogram> grid_face_histogram_ = nullptr;
 
-  std::vector<UnitCellMatrices> unit_cell_matrices_;
+  UnitCellMatricesPool unit_cell_matrices_;
   std::map<uint64_t, UnitCellMatrices> unit_ghost_cell_matrices_;
   std::vector<CellLBSView> cell_transport_views_;
 
@@ -433,6 +451,24 @@ protected:
 private:
   void PrepareForRestarts();
 
+  /**
+   * Assembles a WGDSA delta-phi vector, where `phi(k)` returns the flux moment entry at index `k`
+   * of the flux moment vectors.
+   */
+  template <typename PhiFunction>
+  void AssembleWGDSADeltaPhi(const LBSGroupset& groupset,
+                             PhiFunction phi,
+                             std::vector<double>& delta_phi_local);
+
+  /**
+   * Assembles a TGDSA delta-phi vector, where `phi(k)` returns the flux moment entry at index `k`
+   * of the flux moment vectors.
+   */
+  template <typename PhiFunction>
+  void AssembleTGDSADeltaPhi(const LBSGroupset& groupset,
+                             PhiFunction phi,
+                             std::vector<double>& delta_phi_local);
+
 public:
   static std::map<std::string, uint64_t> supported_boundary_names;
   static std::map<uint64_t, std::string> supported_boundary_ids;
@@ -331,4 +331,64 @@ struct UnitCellMatrices
   std::vector<Vector<double>> intS_shapeI;
 };
 
+/**
+ * The unit cell matrices of a set of cells, indexed by cell local id. Cells added with the same
+ * geometry key share a single set of matrices, so that meshes made of a few distinct cell shapes
+ * only store the matrices of those shapes.
+ */
+class UnitCellMatricesPool
+{
+public:
+  using GeometryKey = std::vector<int64_t>;
+
+  /// Sets the number of cells and discards all matrices.
+  void Reset(size_t num_cells)
+  {
+    matrices_.clear();
+    cell_matrices_ids_.assign(num_cells, 0);
+    key_matrices_ids_.clear();
+  }
+
+  /// Sets the matrices of a cell, not shared with any other cell.
+  void SetCellMatrices(size_t cell, UnitCellMatrices matrices)
+  {
+    cell_matrices_ids_.at(cell) = matrices_.size();
+    matrices_.push_back(std::move(matrices));
+  }
+
+  /**
+   * Sets the matrices of a cell to those of the cells with the same geometry key. The matrices are
+   * computed with `compute()` only for the first cell with a given key.
+   */
+  template <typename Compute>
+  void SetCellMatrices(size_t cell, const GeometryKey& key, Compute compute)
+  {
+    const auto [it, inserted] = key_matrices_ids_.emplace(key, matrices_.size());
+    if (inserted)
+      matrices_.push_back(compute());
+    cell_matrices_ids_.at(cell) = it->second;
+  }
+
+  const UnitCellMatrices& operator[](size_t cell) const
+  {
+    return matrices_[cell_matrices_ids_[cell]];
+  }
+
+  const UnitCellMatrices& at(size_t cell) const
+  {
+    return matrices_.at(cell_matrices_ids_.at(cell));
+  }
+
+  /// Returns the number of cells.
+  size_t size() const { return cell_matrices_ids_.size(); }
+
+  /// Returns the number of distinct sets of matrices stored.
+  size_t NumUniqueMatrices() const { return matrices_.size(); }
+
+private:
+  std::vector<UnitCellMatrices> matrices_;
+  std::vector<size_t> cell_matrices_ids_;
+  std::map<GeometryKey, size_t> key_matrices_ids_;
+};
+
 } // namespace opensn
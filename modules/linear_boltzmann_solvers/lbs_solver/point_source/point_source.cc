@@ -56,26 +56,24 @@ PointSource::Initialize(const LBSSolver& lbs_solver)
   // Find local subscribers
   double total_volume = 0.0;
   std::vector<Subscriber> subscribers;
-  for (const auto& cell : grid.local_cells)
+  for (const uint64_t cell_local_id : grid.FindContainingCells({location_}).front())
   {
-    if (grid.CheckPointInsideCell(cell, location_))
-    {
-      const auto& cell_mapping = discretization.GetCellMapping(cell);
-      const auto& fe_values = unit_cell_matrices[cell.local_id];
-
-      // Map the point source to the finite element space
-      Vector<double> shape_vals;
-      cell_mapping.ShapeValues(location_, shape_vals);
-      const auto M_inv = Inverse(fe_values.intV_shapeI_shapeJ);
-      const auto node_wgts = Mult(M_inv, shape_vals);
-
-      // Increment the total volume
-      total_volume += cell_mapping.CellVolume();
-
-      // Add to subscribers
-      subscribers.push_back(
-        Subscriber{cell_mapping.CellVolume(), cell.local_id, shape_vals, node_wgts});
-    }
+    const auto& cell = grid.local_cells[cell_local_id];
+    const auto& cell_mapping = discretization.GetCellMapping(cell);
+    const auto& fe_values = unit_cell_matrices[cell.local_id];
+
+    // Map the point source to the finite element space
+    Vector<double> shape_vals;
+    cell_mapping.ShapeValues(location_, shape_vals);
+    const auto M_inv = Inverse(fe_values.intV_shapeI_shapeJ);
+    const auto node_wgts = Mult(M_inv, shape_vals);
+
+    // Increment the total volume
+    total_volume += cell_mapping.CellVolume();
+
+    // Add to subscribers
+    subscribers.push_back(
+      Subscriber{cell_mapping.CellVolume(), cell.local_id, shape_vals, node_wgts});
   }
 
   // If the point source lies on a partition boundary, ghost cells must be
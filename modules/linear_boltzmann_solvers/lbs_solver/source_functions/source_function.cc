@@ -11,6 +11,40 @@
 namespace opensn
 {
 
+namespace
+{
+
+/**
+ * Adds `rho` times the product of a groupset transfer block with the flux moments to the source
+ * moments of all nodes of a cell. `phi` and `q` point to the first group of a moment on the first
+ * node, and consecutive nodes are `node_stride` apart. Each matrix entry is applied to all nodes
+ * before moving on to the next one.
+ */
+void
+AddTransferBlockProduct(const MultiGroupXS::TransferBlock& block,
+                        double rho,
+                        size_t first_group,
+                        const double* phi,
+                        double* q,
+                        int num_nodes,
+                        size_t node_stride)
+{
+  const size_t num_rows = block.row_offsets.size() - 1;
+  for (size_t r = 0; r < num_rows; ++r)
+  {
+    double* q_g = q + first_group + r;
+    for (size_t k = block.row_offsets[r]; k < block.row_offsets[r + 1]; ++k)
+    {
+      const double coefficient = rho * block.values[k];
+      const double* phi_gp = phi + block.columns[k];
+      for (int i = 0; i < num_nodes; ++i)
+        q_g[i * node_stride] += coefficient * phi_gp[i * node_stride];
+    }
+  }
+}
+
+} // namespace
+
 SourceFunction::SourceFunction(const LBSSolver& lbs_solver) : lbs_solver_(lbs_solver)
 {
 }
@@ -49,6 +83,7 @@ SourceFunction::operator()(const LBSGroupset& groupset,
 
   const auto num_moments = lbs_solver_.NumMoments();
   const auto& ext_src_moments_local = lbs_solver_.ExtSrcMomentsLocal();
+  const size_t node_stride = lbs_solver_.NumGroups() * num_moments;
 
   const auto& m_to_ell_em_map = groupset.quadrature->GetMomentToHarmonicsIndexMap();
 
@@ -67,13 +102,58 @@ SourceFunction::operator()(const LBSGroupset& groupset,
     if (matid_to_src_map.count(cell.material_id) > 0)
       P0_src = matid_to_src_map.at(cell.material_id);
 
-    const auto& S = xs.TransferMatrices();
     const auto& F = xs.ProductionMatrix();
     const auto& precursors = xs.Precursors();
     const auto& nu_delayed_sigma_f = xs.NuDelayedSigmaF();
 
-    // Loop over nodes
     const auto num_nodes = transport_view.NumNodes();
+
+    // Apply scattering sources to all nodes at once
+    if (apply_ags_scatter_src_ or apply_wgs_scatter_src_)
+    {
+      const auto& transfer = xs.GetGroupsetTransfer(gs_i_, gs_f_);
+      for (int m = 0; m < static_cast<int>(num_moments); ++m)
+      {
+        const auto ell = m_to_ell_em_map[m].ell;
+        if (ell >= transfer.self.size())
+          continue;
+
+        const auto uk_map = transport_view.MapDOF(0, m, 0);
+        const double* phi_m = &phi[uk_map];
+        double* q_m = &q[uk_map];
+
+        // Add Across GroupSet Scattering (AGS)
+        if (apply_ags_scatter_src_)
+          AddTransferBlockProduct(
+            transfer.across_groupset[ell], rho, gs_i_, phi_m, q_m, num_nodes, node_stride);
+
+        // Add Within GroupSet Scattering (WGS)
+        if (apply_wgs_scatter_src_)
+        {
+          AddTransferBlockProduct(
+            transfer.within_groupset[ell], rho, gs_i_, phi_m, q_m, num_nodes, node_stride);
+
+          if (not suppress_wg_scatter_src_)
+          {
+            const auto& self = transfer.self[ell];
+            for (int i = 0; i < num_nodes; ++i)
+            {
+              const size_t offset = i * node_stride;
+              for (size_t g = gs_i_; g <= gs_f_; ++g)
+                q_m[offset + g] += rho * self[g - gs_i_] * phi_m[offset + g];
+            }
+          }
+        }
+      }
+    }
+
+    // Apply fixed and fission sources node by node
+    const bool apply_fission_src =
+      xs.IsFissionable() and (apply_ags_fission_src_ or apply_wgs_fission_src_);
+    if (not apply_fixed_src_ and not apply_fission_src)
+      continue;
+
+    // Loop over nodes
     for (int i = 0; i < num_nodes; ++i)
     {
       // Loop over moments
@@ -103,35 +183,17 @@ SourceFunction::operator()(const LBSGroupset& groupset,
           if (apply_fixed_src_)
             rhs += this->AddSourceMoments();
 
-          // Apply scattering sources
-          if (ell < S.size())
-          {
-            const auto& S_ell = S[ell];
-            // Add Across GroupSet Scattering (AGS)
-            if (apply_ags_scatter_src_)
-              for (const auto& [_, gp, sigma_sm] : S_ell.Row(g))
-                if (gp < gs_i_ or gp > gs_f_)
-                  rhs += rho * sigma_sm * phi_im[gp];
-
-            // Add Within GroupSet Scattering (WGS)
-            if (apply_wgs_scatter_src_)
-              for (const auto& [_, gp, sigma_sm] : S_ell.Row(g))
-                if (gp >= gs_i_ and gp <= gs_f_)
-                {
-                  if (suppress_wg_scatter_src_ and g_ == gp)
-                    continue;
-                  rhs += rho * sigma_sm * phi_im[gp];
-                }
-          }
-
           // Apply fission sources
           if (xs.IsFissionable() and ell == 0)
           {
             const auto& F_g = F[g];
             if (apply_ags_fission_src_)
-              for (size_t gp = first_grp_; gp <= last_grp_; ++gp)
-                if (gp < gs_i_ or gp > gs_f_)
-                  rhs += rho * F_g[gp] * phi_im[gp];
+            {
+              for (size_t gp = first_grp_; gp < gs_i_; ++gp)
+                rhs += rho * F_g[gp] * phi_im[gp];
+              for (size_t gp = gs_f_ + 1; gp <= last_grp_; ++gp)
+                rhs += rho * F_g[gp] * phi_im[gp];
+            }
 
             if (apply_wgs_fission_src_)
               for (size_t gp = gs_i_; gp <= gs_f_; ++gp)
@@ -226,8 +288,6 @@ SourceFunction::AddVolumetricSources(const LBSGroupset& groupset,
 {
   const bool apply_fixed_src = source_flags & APPLY_FIXED_SOURCES;
 
-  const auto& grid = lbs_solver_.Grid();
-  const auto& discretization = lbs_solver_.SpatialDiscretization();
   const auto& cell_transport_views = lbs_solver_.GetCellTransportViews();
   const auto num_groups = lbs_solver_.NumGroups();
 
@@ -239,23 +299,19 @@ SourceFunction::AddVolumetricSources(const LBSGroupset& groupset,
   {
     for (const auto& volumetric_source : lbs_solver_.VolumetricSources())
     {
-      for (const auto local_id : volumetric_source.GetSubscribers())
+      const auto& subscribers = volumetric_source.GetSubscribers();
+      for (size_t s = 0; s < subscribers.size(); ++s)
       {
-        const auto& cell = grid.local_cells[local_id];
-        const auto& transport_view = cell_transport_views[local_id];
-        const auto nodes = discretization.GetCellNodeLocations(cell);
-        const auto num_cell_nodes = discretization.GetCellNumNodes(cell);
+        const auto& transport_view = cell_transport_views[subscribers[s]];
+        const auto src = volumetric_source.GetNodalStrengths(s);
 
-        // Go through each of the cell nodes
-        for (size_t i = 0; i < num_cell_nodes; ++i)
+        // Contribute the precomputed group-wise values of each cell node to the source moments
+        for (size_t i = 0; i < transport_view.NumNodes(); ++i)
         {
-          // Compute group-wise values for this node
-          const auto src = volumetric_source(cell, nodes[i], num_groups);
-
-          // Contribute to the source moments
           const auto dof_map = transport_view.MapDOF(i, 0, 0);
+          const auto node_src = src + i * num_groups;
           for (size_t g = gs_i; g <= gs_f; ++g)
-            q[dof_map + g] += src[g];
+            q[dof_map + g] += node_src[g];
         } // for node i
       }   // for subscriber
     }     // for volumetric source
@@ -105,6 +105,37 @@ VolumetricSource::Initialize(const LBSSolver& lbs_solver)
         subscribers_.push_back(cell.local_id);
   }
 
+  const auto& grid = lbs_solver.Grid();
+  is_subscriber_.assign(grid.local_cells.size(), false);
+  for (const auto local_id : subscribers_)
+    is_subscriber_[local_id] = true;
+
+  // Evaluate the source strengths at the subscriber nodes, in a single batch
+  const auto& discretization = lbs_solver.SpatialDiscretization();
+  num_groups_ = lbs_solver.NumGroups();
+  subscriber_node_offsets_.assign(1, 0);
+  std::vector<Vector3> nodes;
+  for (const auto local_id : subscribers_)
+  {
+    const auto cell_nodes = discretization.GetCellNodeLocations(grid.local_cells[local_id]);
+    nodes.insert(nodes.end(), cell_nodes.begin(), cell_nodes.end());
+    subscriber_node_offsets_.push_back(nodes.size());
+  }
+
+  if (function_)
+  {
+    nodal_strengths_ = function_->EvaluateBatch(nodes, static_cast<int>(num_groups_));
+    if (nodal_strengths_.size() != nodes.size() * num_groups_)
+      throw std::logic_error("The volumetric source function must return a value for each "
+                             "group.");
+  }
+  else
+  {
+    nodal_strengths_.resize(nodes.size() * num_groups_);
+    for (size_t i = 0; i < nodes.size(); ++i)
+      std::copy(strength_.begin(), strength_.end(), nodal_strengths_.begin() + i * num_groups_);
+  }
+
   num_local_subsribers_ = subscribers_.size();
   mpi_comm.all_reduce(num_local_subsribers_, num_global_subscribers_, mpi::op::sum<size_t>());
 
@@ -116,7 +147,7 @@ VolumetricSource::Initialize(const LBSSolver& lbs_solver)
 std::vector<double>
 VolumetricSource::operator()(const Cell& cell, const Vector3& xyz, const int num_groups) const
 {
-  if (std::count(subscribers_.begin(), subscribers_.end(), cell.local_id) == 0)
+  if (cell.local_id >= is_subscriber_.size() or not is_subscriber_[cell.local_id])
     return std::vector<double>(num_groups, 0.0);
   else if (not function_)
     return strength_;
@@ -41,6 +41,15 @@ public:
    */
   std::vector<double> operator()(const Cell& cell, const Vector3& xyz, int num_groups) const;
 
+  /**
+   * Returns the group-wise source strengths at the nodes of the subscriber with the given index
+   * into GetSubscribers(), stored node-major. These are evaluated once, on initialization.
+   */
+  const double* GetNodalStrengths(size_t subscriber) const
+  {
+    return nodal_strengths_.data() + subscriber_node_offsets_[subscriber] * num_groups_;
+  }
+
   size_t NumLocalSubscribers() const { return num_local_subsribers_; }
   size_t NumGlobalSubsribers() const { return num_global_subscribers_; }
 
@@ -59,6 +68,13 @@ private:
   size_t num_global_subscribers_ = 0;
 
   std::vector<uint64_t> subscribers_;
+  /// Whether each local cell is a subscriber, indexed by local id.
+  std::vector<bool> is_subscriber_;
+
+  size_t num_groups_ = 0;
+  /// Index of the first node of each subscriber, with the total number of nodes last.
+  std::vector<size_t> subscriber_node_offsets_;
+  std::vector<double> nodal_strengths_;
 };
 
 } // namespace opensn
@@ -426,23 +426,26 @@ ResponseEvaluator::EvaluateResponse(const std::string& buffer) const
 
   // Volumetric sources
   for (const auto& volumetric_source : volumetric_sources_)
-    for (const uint64_t local_id : volumetric_source.GetSubscribers())
+  {
+    const auto& subscribers = volumetric_source.GetSubscribers();
+    for (size_t s = 0; s < subscribers.size(); ++s)
     {
-      const auto& cell = grid.local_cells[local_id];
-      const auto& transport_view = transport_views[cell.local_id];
-      const auto& fe_values = unit_cell_matrices[cell.local_id];
-      const auto& nodes = discretization.GetCellNodeLocations(cell);
+      const auto local_id = subscribers[s];
+      const auto& transport_view = transport_views[local_id];
+      const auto& fe_values = unit_cell_matrices[local_id];
+      const auto src = volumetric_source.GetNodalStrengths(s);
 
       const auto num_cell_nodes = transport_view.NumNodes();
       for (size_t i = 0; i < num_cell_nodes; ++i)
       {
         const auto& V_i = fe_values.intV_shapeI(i);
         const auto dof_map = transport_view.MapDOF(i, 0, 0);
-        const auto& vals = volumetric_source(cell, nodes[i], num_groups);
+        const auto vals = src + i * num_groups;
         for (size_t g = 0; g < num_groups; ++g)
           local_response += vals[g] * phi_dagger[dof_map + g] * V_i;
       }
     }
+  }
 
   double global_response = 0.0;
   mpi_comm.all_reduce(local_response, global_response, mpi::op::sum<double>());
@@ -0,0 +1,71 @@
+#include "lua/framework/console/console.h"
+#include "framework/parameters/input_parameters.h"
+#include "framework/data_types/index_map.h"
+#include "framework/logging/log.h"
+#include "framework/runtime.h"
+#include <map>
+
+using namespace opensn;
+
+namespace unit_tests
+{
+
+ParameterBlock
+IndexMapTest(const InputParameters&)
+{
+  OpenSnLogicalErrorIf(opensn::mpi_comm.size() != 1, "Requires 1 processor");
+
+  opensn::log.Log() << "GOLD_BEGIN";
+
+  IndexMap index_map;
+  opensn::log.Log() << "empty: size = " << index_map.Size()
+                    << " find(0) = " << (index_map.Find(0) != nullptr);
+
+  // Sparse, strided global ids force collisions and several rehashes
+  std::map<uint64_t, uint64_t> reference;
+  for (uint64_t i = 0; i < 10000; ++i)
+  {
+    const uint64_t key = 7 * i * i + (i % 3) * (1ULL << 40);
+    const bool inserted = index_map.Insert(key, i);
+    if (reference.insert({key, i}).second != inserted)
+      opensn::log.Log() << "insert mismatch for key " << key;
+  }
+  opensn::log.Log() << "size = " << index_map.Size() << " reference size = " << reference.size();
+
+  bool all_found = true;
+  for (const auto& [key, value] : reference)
+    all_found = all_found and index_map.Contains(key) and index_map.At(key) == value;
+  opensn::log.Log() << "all keys found: " << all_found;
+
+  const bool duplicate_inserted = index_map.Insert(63, 123);
+  opensn::log.Log() << "duplicate insert: " << duplicate_inserted
+                    << " At(63) = " << index_map.At(63);
+  opensn::log.Log() << "missing key: " << index_map.Contains(8);
+
+  try
+  {
+    index_map.At(8);
+    opensn::log.Log() << "At(missing) did not throw";
+  }
+  catch (const std::out_of_range&)
+  {
+    opensn::log.Log() << "At(missing) threw std::out_of_range";
+  }
+
+  index_map.Clear();
+  opensn::log.Log() << "cleared: size = " << index_map.Size()
+                    << " contains(63) = " << index_map.Contains(63);
+
+  index_map.Reserve(100);
+  for (uint64_t i = 0; i < 100; ++i)
+    index_map.Insert(i, 100 - i);
+  opensn::log.Log() << "reserved: size = " << index_map.Size() << " At(42) = " << index_map.At(42);
+
+  opensn::log.Log() << "GOLD_END";
+
+  return ParameterBlock();
+}
+
+RegisterWrapperFunctionInNamespace(unit_tests, IndexMapTest, nullptr, IndexMapTest);
+
+} // namespace unit_tests
@@ -50,7 +50,7 @@ TestKBAGraphPartitioner00(const InputParameters&)
                                     {-1.0, 1.0, 1.0},
                                     {1.0, 1.0, 1.0}};
 
-  auto cell_pids = partitioner.Partition(dummy_graph, centroids, 2 * 2 * 2);
+  auto cell_pids = partitioner.Partition(dummy_graph, centroids, 2 * 2 * 2, {}, {});
 
   for (const int64_t pid : cell_pids)
     opensn::log.Log() << pid;
@@ -0,0 +1,47 @@
+#include "lua/framework/console/console.h"
+#include "framework/graphs/linear_graph_partitioner.h"
+#include "framework/object_factory.h"
+
+#include "framework/mesh/mesh.h"
+
+#include "framework/runtime.h"
+#include "framework/logging/log.h"
+
+using namespace opensn;
+
+namespace unit_tests
+{
+
+ParameterBlock TestLinearGraphPartitioner00(const InputParameters&);
+
+RegisterWrapperFunctionInNamespace(unit_tests,
+                                   TestLinearGraphPartitioner00,
+                                   nullptr,
+                                   TestLinearGraphPartitioner00);
+
+ParameterBlock
+TestLinearGraphPartitioner00(const InputParameters&)
+{
+  opensn::log.Log() << "GOLD_BEGIN";
+
+  InputParameters valid_parameters = LinearGraphPartitioner::GetInputParameters();
+
+  valid_parameters.AssignParameters(ParameterBlock());
+
+  LinearGraphPartitioner partitioner(valid_parameters);
+
+  std::vector<std::vector<uint64_t>> dummy_graph(8);
+  std::vector<Vector3> centroids(8);
+  std::vector<double> weights = {4.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 2.0};
+
+  auto cell_pids = partitioner.Partition(dummy_graph, centroids, 3, weights, {});
+
+  for (const int64_t pid : cell_pids)
+    opensn::log.Log() << pid;
+
+  opensn::log.Log() << "GOLD_END";
+
+  return ParameterBlock();
+}
+
+} //  namespace unit_tests
@@ -0,0 +1 @@
+unit_tests.TestLinearGraphPartitioner00()
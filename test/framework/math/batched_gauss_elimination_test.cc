@@ -0,0 +1,76 @@
+#include "lua/framework/console/console.h"
+#include "framework/parameters/input_parameters.h"
+#include "framework/math/dense_matrix.h"
+#include "framework/math/vector.h"
+#include "framework/logging/log.h"
+#include "framework/runtime.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace opensn;
+
+namespace unit_tests
+{
+
+ParameterBlock
+BatchedGaussEliminationTest(const InputParameters&)
+{
+  OpenSnLogicalErrorIf(opensn::mpi_comm.size() != 1, "Requires 1 processor");
+
+  std::mt19937 generator(4321);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+  // The unrolled sizes (2, 4 and 8) and generic ones (triangles, prisms), each with batches that
+  // are smaller and larger than a vector register
+  for (unsigned int n : {2, 3, 4, 6, 8})
+  {
+    for (size_t batch_size : {1, 7, 64})
+    {
+      std::vector<double> A(n * n * batch_size);
+      std::vector<double> b(n * batch_size);
+      std::vector<DenseMatrix<double>> A_ref(batch_size, DenseMatrix<double>(n, n));
+      std::vector<Vector<double>> b_ref(batch_size, Vector<double>(n));
+
+      // Random, diagonally dominant systems, like the cell systems of the sweep
+      for (size_t l = 0; l < batch_size; ++l)
+      {
+        for (unsigned int i = 0; i < n; ++i)
+        {
+          for (unsigned int j = 0; j < n; ++j)
+          {
+            const double value = distribution(generator) + (i == j ? 2.0 * n : 0.0);
+            A[(i * n + j) * batch_size + l] = value;
+            A_ref[l](i, j) = value;
+          }
+          const double value = distribution(generator);
+          b[i * batch_size + l] = value;
+          b_ref[l](i) = value;
+        }
+      }
+
+      BatchedGaussEliminationDispatch(A.data(), b.data(), n, batch_size);
+
+      double max_difference = 0.0;
+      for (size_t l = 0; l < batch_size; ++l)
+      {
+        GaussElimination(A_ref[l], b_ref[l], n);
+        for (unsigned int i = 0; i < n; ++i)
+          max_difference =
+            std::max(max_difference, std::fabs(b[i * batch_size + l] - b_ref[l](i)));
+      }
+
+      opensn::log.Log() << "n = " << n << ", batch size = " << batch_size
+                        << ": matches GaussElimination " << (max_difference < 1.0e-12);
+    }
+  }
+
+  return ParameterBlock();
+}
+
+RegisterWrapperFunctionInNamespace(unit_tests,
+                                   BatchedGaussEliminationTest,
+                                   nullptr,
+                                   BatchedGaussEliminationTest);
+
+} // namespace unit_tests
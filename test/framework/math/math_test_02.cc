@@ -168,6 +168,20 @@ math_Test02_ParallelVector(const InputParameters&)
     opensn::log.LogAll() << "ghost_vec2 GetGlobalValue(ghost): " << ghost_vec2.GetGlobalValue(1)
                          << std::endl;
 
+  GhostedParallelSTLVector ghost_vec3(vgc);
+
+  if (opensn::mpi_comm.rank() == 0)
+    ghost_vec3.SetValues({5, 6}, {12.0, 14.0}, VecOpType::ADD_VALUE);
+  else
+    ghost_vec3.SetValues({0, 1, 3}, {2.0, 4.0, 8.0}, VecOpType::ADD_VALUE);
+
+  ghost_vec3.Assemble();
+  ghost_vec3.BeginGhostCommunication();
+  ghost_vec3.EndGhostCommunication();
+
+  opensn::log.LogAll() << "ghost_vec3 after split communication: " << ghost_vec3.PrintStr()
+                       << std::endl;
+
   return ParameterBlock();
 }
 
@@ -0,0 +1,90 @@
+#include "lua/framework/console/console.h"
+#include "framework/parameters/input_parameters.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/logging/log.h"
+#include "framework/runtime.h"
+#include <algorithm>
+#include <random>
+
+using namespace opensn;
+
+namespace unit_tests
+{
+
+/**Counts the points for which the search tree and a scan over all local cells disagree.*/
+static size_t
+CountPointLocationMismatches(const MeshContinuum& grid)
+{
+  // Cell and face centroids and vertices exercise points inside cells and on shared boundaries
+  std::vector<Vector3> points;
+  for (const auto& cell : grid.local_cells)
+  {
+    points.push_back(cell.centroid);
+    for (const auto& face : cell.faces)
+      points.push_back(face.centroid);
+    for (uint64_t vid : cell.vertex_ids)
+      points.push_back(grid.vertices[vid]);
+  }
+
+  // Random points over a slightly enlarged local bounding box, some of which are outside the mesh
+  auto [box_min, box_max] = grid.GetLocalBoundingBox();
+  const auto margin = 0.1 * (box_max - box_min);
+  box_min -= margin;
+  box_max += margin;
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  for (int i = 0; i < 2000; ++i)
+    points.emplace_back(box_min.x + unit(generator) * (box_max.x - box_min.x),
+                        box_min.y + unit(generator) * (box_max.y - box_min.y),
+                        box_min.z + unit(generator) * (box_max.z - box_min.z));
+
+  const auto containing_cells = grid.FindContainingCells(points);
+
+  size_t num_mismatches = 0;
+  for (size_t p = 0; p < points.size(); ++p)
+  {
+    std::vector<uint64_t> reference;
+    for (const auto& cell : grid.local_cells)
+      if (grid.CheckPointInsideCell(cell, points[p]))
+        reference.push_back(cell.local_id);
+
+    const auto candidates = grid.FindCandidateCells(points[p]);
+    const bool candidates_cover_reference =
+      std::includes(candidates.begin(), candidates.end(), reference.begin(), reference.end());
+
+    if (containing_cells[p] != reference or not candidates_cover_reference)
+      ++num_mismatches;
+  }
+
+  return num_mismatches;
+}
+
+ParameterBlock
+PointLocationTest(const InputParameters&)
+{
+  auto grid_ptr = GetCurrentMesh();
+  auto& grid = *grid_ptr;
+
+  size_t local_mismatches = CountPointLocationMismatches(grid);
+  size_t num_mismatches = 0;
+  mpi_comm.all_reduce(local_mismatches, num_mismatches, mpi::op::sum<size_t>());
+  opensn::log.Log() << "Point location mismatches: " << num_mismatches;
+
+  // Move the mesh away from where the search tree was built. Recomputing the cell geometry must
+  // invalidate the tree.
+  const Vector3 shift(3.0, -3.0, 0.5);
+  for (auto& [vid, vertex] : grid.vertices)
+    vertex += shift;
+  for (auto& cell : grid.local_cells)
+    cell.RecomputeCentroidsAndNormals(grid);
+
+  local_mismatches = CountPointLocationMismatches(grid);
+  mpi_comm.all_reduce(local_mismatches, num_mismatches, mpi::op::sum<size_t>());
+  opensn::log.Log() << "Point location mismatches after moving the mesh: " << num_mismatches;
+
+  return ParameterBlock();
+}
+
+RegisterWrapperFunctionInNamespace(unit_tests, PointLocationTest, nullptr, PointLocationTest);
+
+} // namespace unit_tests
@@ -0,0 +1,17 @@
+-- Point location through the MeshContinuum search tree on an extruded triangle mesh
+meshgen1 = mesh.ExtruderMeshGenerator.Create({
+  inputs = {
+    mesh.FromFileMeshGenerator.Create({
+      filename = "../../assets/mesh/TriangleMesh2x2.obj",
+    }),
+  },
+  layers = { { z = 1.1, n = 2 }, { z = 2.1, n = 3 } },
+  partitioner = mesh.KBAGraphPartitioner.Create({
+    nx = 2,
+    ny = 1,
+    xcuts = { 0.0 },
+  }),
+})
+mesh.MeshGenerator.Execute(meshgen1)
+
+unit_tests.PointLocationTest()
@@ -0,0 +1,127 @@
+-- DFEM diffusion with analytical coefficients, evaluated point by point and in batches
+--############################################### Setup mesh
+nodes = {}
+N = 100
+L = 2
+xmin = -L / 2
+dx = L / N
+for i = 1, (N + 1) do
+  k = i - 1
+  nodes[i] = xmin + k * dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+function D_coef(i, pt)
+  return 3.0 + pt.x + pt.y
+end
+function Q_ext(i, pt)
+  return pt.x * pt.x
+end
+function Sigma_a(i, pt)
+  return pt.x * pt.y * pt.y
+end
+
+-- Setboundary IDs
+-- xmin,xmax,ymin,ymax,zmin,zmax
+e_vol = logvol.RPPLogicalVolume.Create({ xmin = 0.99999, xmax = 1000.0, infy = true, infz = true })
+w_vol =
+  logvol.RPPLogicalVolume.Create({ xmin = -1000.0, xmax = -0.99999, infy = true, infz = true })
+n_vol = logvol.RPPLogicalVolume.Create({ ymin = 0.99999, ymax = 1000.0, infx = true, infz = true })
+s_vol =
+  logvol.RPPLogicalVolume.Create({ ymin = -1000.0, ymax = -0.99999, infx = true, infz = true })
+
+e_bndry = "0"
+w_bndry = "1"
+n_bndry = "2"
+s_bndry = "3"
+
+mesh.SetBoundaryIDFromLogicalVolume(e_vol, e_bndry)
+mesh.SetBoundaryIDFromLogicalVolume(w_vol, w_bndry)
+mesh.SetBoundaryIDFromLogicalVolume(n_vol, n_bndry)
+mesh.SetBoundaryIDFromLogicalVolume(s_vol, s_bndry)
+
+diff_options = {
+  boundary_conditions = {
+    {
+      boundary = e_bndry,
+      type = "dirichlet",
+      coeffs = { 0.0 },
+    },
+    {
+      boundary = n_bndry,
+      type = "dirichlet",
+      coeffs = { 0.0 },
+    },
+    {
+      boundary = s_bndry,
+      type = "dirichlet",
+      coeffs = { 0.0 },
+    },
+    {
+      boundary = w_bndry,
+      type = "dirichlet",
+      coeffs = { 0.0 },
+    },
+  },
+}
+
+vol0 = logvol.RPPLogicalVolume.Create({ infx = true, infy = true, infz = true })
+
+-- Solves the problem with the coefficient functions defined when called and returns the maximum
+function SolveForMaxValue(name)
+  local phys = diffusion.DFEMDiffusionSolver.Create({
+    name = name,
+    residual_tolerance = 1e-8,
+  })
+  diffusion.SetOptions(phys, diff_options)
+
+  solver.Initialize(phys)
+  solver.Execute(phys)
+
+  local fflist, count = solver.GetFieldFunctionList(phys)
+
+  local ffvol = fieldfunc.FFInterpolationCreate(VOLUME)
+  fieldfunc.SetProperty(ffvol, OPERATION, OP_MAX)
+  fieldfunc.SetProperty(ffvol, LOGICAL_VOLUME, vol0)
+  fieldfunc.SetProperty(ffvol, ADD_FIELDFUNCTION, fflist[1])
+
+  fieldfunc.Initialize(ffvol)
+  fieldfunc.Execute(ffvol)
+  return fieldfunc.GetValue(ffvol)
+end
+
+-- Point by point
+maxval_scalar = SolveForMaxValue("DFEMDiffusionSolverScalar")
+
+-- The solver picks up the "_batch" variants when they are defined
+function D_coef_batch(i, pts)
+  local values = {}
+  for p = 1, #pts do
+    values[p] = D_coef(i, pts[p])
+  end
+  return values
+end
+function Q_ext_batch(i, pts)
+  local values = {}
+  for p = 1, #pts do
+    values[p] = Q_ext(i, pts[p])
+  end
+  return values
+end
+function Sigma_a_batch(i, pts)
+  local values = {}
+  for p = 1, #pts do
+    values[p] = Sigma_a(i, pts[p])
+  end
+  return values
+end
+
+maxval_batch = SolveForMaxValue("DFEMDiffusionSolverBatch")
+
+log.Log(LOG_0, string.format("Max-value=%.6f", maxval_batch))
+log.Log(LOG_0, string.format("Max-value difference=%.6e", math.abs(maxval_batch - maxval_scalar)))
@@ -71,8 +71,8 @@ acceleration_Diffusion_DFEM(const InputParameters&)
   MatID2XSMap matid_2_xs_map;
   matid_2_xs_map.insert(std::make_pair(0, Multigroup_D_and_sigR{{1.0}, {0.0}}));
 
-  std::vector<UnitCellMatrices> unit_cell_matrices;
-  unit_cell_matrices.resize(grid.local_cells.size());
+  UnitCellMatricesPool unit_cell_matrices;
+  unit_cell_matrices.Reset(grid.local_cells.size());
 
   // Build unit integrals
   for (const auto& cell : grid.local_cells)
@@ -141,14 +141,15 @@ acceleration_Diffusion_DFEM(const InputParameters&)
       }   // for i
     }     // for f
 
-    unit_cell_matrices[cell.local_id] = UnitCellMatrices{IntV_gradshapeI_gradshapeJ,
-                                                         {},
-                                                         IntV_shapeI_shapeJ,
-                                                         IntV_shapeI,
+    unit_cell_matrices.SetCellMatrices(cell.local_id,
+                                       UnitCellMatrices{IntV_gradshapeI_gradshapeJ,
+                                                        {},
+                                                        IntV_shapeI_shapeJ,
+                                                        IntV_shapeI,
 
-                                                         IntS_shapeI_shapeJ,
-                                                         IntS_shapeI_gradshapeJ,
-                                                         IntS_shapeI};
+                                                        IntS_shapeI_shapeJ,
+                                                        IntS_shapeI_gradshapeJ,
+                                                        IntS_shapeI});
   } // for cell
 
   auto mms_phi_function = CreateFunction("MMS_phi");
@@ -0,0 +1,65 @@
+-- 2D 2G KEigenvalue::Solver test using Power Iteration and the CBC sweep.
+-- Single-precision angular flux (OPENSN_WITH_FLOAT_PSI) regression.
+-- Test: Final k-eigenvalue: 0.5969127
+
+dofile("../transport_keigen/utils/qblock_mesh.lua")
+
+--############################################### Create cross sections
+xss = {}
+
+for m = 0, 1 do
+  xss[tostring(m)] = xs.Create()
+end
+
+xs.Set(xss["0"], OPENSN_XSFILE, "../transport_keigen/xs_water_g2.xs")
+xs.Set(xss["1"], OPENSN_XSFILE, "../transport_keigen/xs_fuel_g2.xs")
+
+water_xs = xs.Get(xss["0"])
+num_groups = water_xs["num_groups"]
+
+--############################################### Create materials
+materials = {}
+for m = 0, 1 do
+  key = tostring(m)
+  materials[key] = mat.AddMaterial("Material_" .. key)
+  mat.SetProperty(materials[key], TRANSPORT_XSECTIONS, EXISTING, xss[key])
+end
+
+--############################################### Setup Physics
+pquad = aquad.CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV, 4, 4)
+aquad.OptimizeForPolarSymmetry(pquad, 4.0 * math.pi)
+
+lbs_block = {
+  num_groups = num_groups,
+  groupsets = {
+    {
+      groups_from_to = { 0, num_groups - 1 },
+      angular_quadrature_handle = pquad,
+      inner_linear_method = "petsc_gmres",
+      l_max_its = 50,
+      gmres_restart_interval = 50,
+      l_abs_tol = 1.0e-6,
+      groupset_num_subsets = 2,
+    },
+  },
+  options = {
+    boundary_conditions = {
+      { name = "xmin", type = "reflecting" },
+      { name = "ymin", type = "reflecting" },
+    },
+    scattering_order = 2,
+
+    use_precursors = false,
+
+    verbose_inner_iterations = false,
+    verbose_outer_iterations = true,
+    save_angular_flux = true,
+  },
+  sweep_type = "CBC",
+}
+
+phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+k_solver0 = lbs.PowerIterationKEigen.Create({ lbs_solver_handle = phys1 })
+solver.Initialize(k_solver0)
+solver.Execute(k_solver0)
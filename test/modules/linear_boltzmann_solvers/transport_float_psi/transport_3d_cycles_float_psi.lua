@@ -0,0 +1,132 @@
+-- 3D Transport test with Vacuum and Incident-isotropic BC on a mesh with cyclic sweep
+-- dependencies. Single-precision angular flux (OPENSN_WITH_FLOAT_PSI) regression.
+-- SDM: PWLD
+-- Test: Max-value1=5.55349e-01 and Max-value2=3.74343e-04
+num_procs = 4
+
+--############################################### Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+meshgen1 = mesh.ExtruderMeshGenerator.Create({
+  inputs = {
+    mesh.FromFileMeshGenerator.Create({
+      filename = "../../../assets/mesh/Square2x2_partition_cyclic3.obj",
+    }),
+  },
+  layers = { { z = 0.4, n = 2 }, { z = 0.8, n = 2 }, { z = 1.2, n = 2 }, { z = 1.6, n = 2 } }, -- layers
+  partitioner = mesh.KBAGraphPartitioner.Create({
+    nx = 2,
+    ny = 2,
+    nz = 1,
+    xcuts = { 0.0 },
+    ycuts = { 0.0 },
+  }),
+})
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+vol0 = logvol.RPPLogicalVolume.Create({ infx = true, infy = true, infz = true })
+mesh.SetMaterialIDFromLogicalVolume(vol0, 0)
+
+vol1 =
+  logvol.RPPLogicalVolume.Create({ xmin = -0.5, xmax = 0.5, ymin = -0.5, ymax = 0.5, infz = true })
+mesh.SetMaterialIDFromLogicalVolume(vol1, 1)
+
+--############################################### Add materials
+materials = {}
+materials[1] = mat.AddMaterial("Test Material")
+materials[2] = mat.AddMaterial("Test Material2")
+
+num_groups = 21
+xs_file = "../transport_steady/xs_graphite_pure.xs"
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, OPENSN_XSFILE, xs_file)
+mat.SetProperty(materials[2], TRANSPORT_XSECTIONS, OPENSN_XSFILE, xs_file)
+
+src = {}
+for g = 1, num_groups do
+  src[g] = 0.0
+end
+
+mat.SetProperty(materials[1], ISOTROPIC_MG_SOURCE, FROM_ARRAY, src)
+mat.SetProperty(materials[2], ISOTROPIC_MG_SOURCE, FROM_ARRAY, src)
+
+--############################################### Setup Physics
+pquad0 = aquad.CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV, 2, 2)
+
+lbs_block = {
+  num_groups = num_groups,
+  groupsets = {
+    {
+      groups_from_to = { 0, 20 },
+      angular_quadrature_handle = pquad0,
+      --angle_aggregation_type = "single",
+      angle_aggregation_num_subsets = 1,
+      groupset_num_subsets = 1,
+      inner_linear_method = "petsc_gmres",
+      l_abs_tol = 1.0e-6,
+      l_max_its = 300,
+      gmres_restart_interval = 30,
+    },
+  },
+}
+bsrc = {}
+for g = 1, num_groups do
+  bsrc[g] = 0.0
+end
+bsrc[1] = 1.0 / 4.0 / math.pi
+lbs_options = {
+  boundary_conditions = {
+    { name = "zmax", type = "isotropic", group_strength = bsrc },
+  },
+  scattering_order = 1,
+}
+if reflecting then
+  table.insert(lbs_options.boundary_conditions, { name = "zmax", type = "reflecting" })
+end
+
+phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+lbs.SetOptions(phys1, lbs_options)
+
+--############################################### Initialize and Execute Solver
+ss_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys1 })
+
+solver.Initialize(ss_solver)
+solver.Execute(ss_solver)
+
+--############################################### Get field functions
+fflist, count = lbs.GetScalarFieldFunctionList(phys1)
+
+--############################################### Volume integrations
+ffi1 = fieldfunc.FFInterpolationCreate(VOLUME)
+curffi = ffi1
+fieldfunc.SetProperty(curffi, OPERATION, OP_MAX)
+fieldfunc.SetProperty(curffi, LOGICAL_VOLUME, vol0)
+fieldfunc.SetProperty(curffi, ADD_FIELDFUNCTION, fflist[1])
+
+fieldfunc.Initialize(curffi)
+fieldfunc.Execute(curffi)
+maxval = fieldfunc.GetValue(curffi)
+
+log.Log(LOG_0, string.format("Max-value1=%.5e", maxval))
+
+ffi1 = fieldfunc.FFInterpolationCreate(VOLUME)
+curffi = ffi1
+fieldfunc.SetProperty(curffi, OPERATION, OP_MAX)
+fieldfunc.SetProperty(curffi, LOGICAL_VOLUME, vol0)
+fieldfunc.SetProperty(curffi, ADD_FIELDFUNCTION, fflist[20])
+
+fieldfunc.Initialize(curffi)
+fieldfunc.Execute(curffi)
+maxval = fieldfunc.GetValue(curffi)
+
+log.Log(LOG_0, string.format("Max-value2=%.5e", maxval))